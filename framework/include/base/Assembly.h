@@ -315,6 +315,16 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not cached residual contributions to locally owned dofs should be summed into a
+   * dense buffer owned by this thread instead of being appended to the cache vectors.  The buffer
+   * is only added to the residual vector when addCachedResidual() is called, so threads do not
+   * need to lock while assembling.
+   *
+   * @param thread_local_residual True to accumulate into the per-thread buffer
+   */
+  void useThreadLocalResidual(bool thread_local_residual) { _thread_local_residual = thread_local_residual; }
+
   void prepare();
 
   /**
@@ -438,12 +448,16 @@ protected:
   void reinitFEFace(const Elem * elem, unsigned int side);
 
   void addResidualBlock(NumericVector<Number> & residual, DenseVector<Number> & res_block, const std::vector<dof_id_type> & dof_indices, Real scaling_factor);
-  void cacheResidualBlock(std::vector<Real> & cached_residual_values,
-                          std::vector<dof_id_type> & cached_residual_rows,
+  void cacheResidualBlock(unsigned int type,
                           DenseVector<Number> & res_block,
                           std::vector<dof_id_type> & dof_indices,
                           Real scaling_factor);
 
+  /**
+   * Resize the thread local residual buffers if the local dof range changed
+   */
+  void prepareLocalResidual();
+
   void setResidualBlock(NumericVector<Number> & residual, DenseVector<Number> & res_block, std::vector<dof_id_type> & dof_indices, Real scaling_factor);
 
   void addJacobianBlock(SparseMatrix<Number> & jacobian, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
@@ -658,6 +672,17 @@ protected:
 
   unsigned int _max_cached_residuals;
 
+  /// Whether or not residuals for locally owned dofs are summed into _local_residual
+  bool _thread_local_residual;
+  /// Dense residual buffers indexed by local dof (the first vector is for TIME vs NONTIME)
+  std::vector<std::vector<Real> > _local_residual;
+  /// Whether or not anything was summed into _local_residual since the last addCachedResidual()
+  std::vector<bool> _local_residual_used;
+  /// Global dof indices of the entries in _local_residual
+  std::vector<dof_id_type> _local_residual_rows;
+  /// The first locally owned dof at the time _local_residual was sized
+  dof_id_type _local_residual_first_dof;
+
   /// Values cached by calling cacheJacobian()
   std::vector<Real> _cached_jacobian_values;
   /// Row where the corresponding cached value should go
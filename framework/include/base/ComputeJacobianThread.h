@@ -41,12 +41,22 @@ public:
 
   void join(const ComputeJacobianThread & /*y*/);
 
+  /**
+   * Insert element contributions straight into the matrix without taking the global lock.
+   * Only safe when no two elements processed concurrently touch the same matrix entries
+   * (i.e. when looping over one color of MooseMesh::getActiveLocalElementColorRanges()).
+   */
+  void useDirectInsertion(bool direct_insertion) { _direct_insertion = direct_insertion; }
+
 protected:
   SparseMatrix<Number> & _jacobian;
   NonlinearSystem & _sys;
 
   unsigned int _num_cached;
 
+  /// Whether contributions are added directly to the matrix (no cache, no lock)
+  bool _direct_insertion;
+
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian();
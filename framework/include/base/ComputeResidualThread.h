@@ -46,6 +46,8 @@ protected:
   NonlinearSystem & _sys;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
+  /// Whether or not residuals are accumulated without locking (see FEProblem::threadLocalResidual())
+  bool _thread_local_residual;
 };
 
 #endif //COMPUTERESIDUALTHREAD_H
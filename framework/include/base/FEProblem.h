@@ -821,6 +821,17 @@ public:
 
   void setErrorOnJacobianNonzeroReallocation(bool state) { _error_on_jacobian_nonzero_reallocation = state; }
 
+  /**
+   * Whether or not residual contributions are accumulated per thread and only added
+   * to the residual vector once all elements have been visited
+   */
+  bool threadLocalResidual() const { return _thread_local_residual; }
+
+  /**
+   * Whether or not the Jacobian is assembled one element color at a time without locking
+   */
+  bool coloredJacobianAssembly() const { return _colored_jacobian_assembly; }
+
 
 
 protected:
@@ -988,6 +999,12 @@ private:
 
   bool _error_on_jacobian_nonzero_reallocation;
 
+  /// Whether or not residuals are accumulated into per-thread buffers
+  bool _thread_local_residual;
+
+  /// Whether or not the Jacobian is assembled by element color
+  bool _colored_jacobian_assembly;
+
   /**
    * NOTE: This is an internal function meant for MOOSE use only!
    *
@@ -50,6 +50,8 @@ class Factory;
 // forward declarations
 class Syntax;
 class FEProblem;
+class ObjectPerfLog;
+class TraceLog;
 
 /// Execution flags - when is the object executed/evaluated
 // Note: If this enum is changed, make sure to modify:
@@ -116,6 +118,16 @@ extern PerfLog perf_log;
  * PerfLog to be used during setup.  This log will get printed just before the first solve. */
 extern PerfLog setup_perf_log;
 
+/**
+ * Per-object timing of the threaded loops.  Off unless an output or postprocessor enables it.
+ */
+extern ObjectPerfLog object_perf_log;
+
+/**
+ * Timeline of the solve phases.  Off unless a Trace output enables it.
+ */
+extern TraceLog trace_log;
+
 /**
  * A static list of all the exec types.
  */
@@ -74,6 +74,7 @@ public:
    * Get the MooseApp this object is associated with.
    */
   MooseApp & getMooseApp() { return _app; }
+  const MooseApp & getMooseApp() const { return _app; }
 
 protected:
 
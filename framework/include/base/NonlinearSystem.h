@@ -68,6 +68,13 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+
+  /**
+   * Release the coloring used by the finite differenced preconditioner, so that it is
+   * rebuilt from the new sparsity pattern on the next solve.  Called when the mesh changes.
+   */
+  void clearFiniteDifferencedColoring();
+
   void setupDecomposition();
   void setupSplitBasedPreconditioner();
 
@@ -208,6 +215,13 @@ public:
    */
   void addImplicitGeometricCouplingEntries(SparseMatrix<Number> & jacobian, GeometricSearchData & geom_search_data);
 
+  /**
+   * Adds zero entries to the Jacobian at every position of the element sparsity pattern
+   * (honoring the coupling matrix, DG neighbors, scalar variables and constraints), so that
+   * its nonzero structure is known without evaluating any Kernels.
+   */
+  void addSparsityPatternEntries(SparseMatrix<Number> & jacobian);
+
   /**
    * Add jacobian contributions from Constraints
    *
@@ -512,6 +526,8 @@ protected:
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
 #endif
+  /// Whether _fdcoloring holds a coloring that is still valid for the current mesh
+  bool _have_fdcoloring;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
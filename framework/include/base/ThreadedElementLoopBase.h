@@ -18,6 +18,7 @@
 #include "ParallelUniqueId.h"
 #include "MooseMesh.h"
 #include "MooseTypes.h"
+#include "TraceLog.h"
 
 /**
  * Base class for assembling-like calculations
@@ -120,6 +121,8 @@ ThreadedElementLoopBase<RangeType>::operator () (const RangeType & range, bool b
   ParallelUniqueId puid;
   _tid = bypass_threading ? 0 : puid.id;
 
+  TraceScope trace(Moose::trace_log, "element_loop", "Threads", _tid);
+
   pre();
 
   _subdomain = std::numeric_limits<SubdomainID>::max();
@@ -126,6 +126,17 @@ public:
    */
   void clearPoints();
 
+  /**
+   * Replace the points of this DiracKernel, and its point caches, with those
+   * of another copy of the same DiracKernel.  This is used to give the copies
+   * on the other threads the points located by the copy on thread 0, so that
+   * addPoints() only has to be called once.
+   *
+   * DiracKernels that keep their own per-point data from addPoints() must
+   * override this, copy that data as well and call this version.
+   */
+  virtual void copyPointsFrom(DiracKernel & other);
+
 protected:
   /**
    * Add the physical x,y,z point located in the element "elem" to the list of points
@@ -56,7 +56,7 @@ public:
   /**
    * Return true if we have Point 'p' in Element 'elem'
    */
-  bool hasPoint(const Elem * elem, Point p);
+  bool hasPoint(const Elem * elem, Point p) const;
 
   /**
    * Returns a writeable reference to the _elements container.
@@ -80,7 +80,24 @@ public:
    */
   const Elem * findPoint(Point p, const MooseMesh& mesh);
 
+  /**
+   * Determine the Elem in which the Point p resides, starting from the Elem
+   * hint in which it was previously found.  Points that moved a short
+   * distance are found by walking across the element neighbors of hint, the
+   * PointLocator is only used if that walk fails.
+   */
+  const Elem * findPoint(Point p, const MooseMesh& mesh, const Elem * hint);
+
 protected:
+  /**
+   * Walks from hint towards p across element neighbors.  Returns the Elem
+   * containing p or NULL if it was not found within _max_walk_steps elements.
+   */
+  const Elem * walkToPoint(Point p, const Elem * hint) const;
+
+  /// The maximum number of elements visited by walkToPoint()
+  static const unsigned int _max_walk_steps = 16;
+
   /// The list of elements that need distributions.
   std::set<const Elem *> _elements;
 
@@ -17,6 +17,7 @@
 
 #include "MooseTypes.h"
 #include "MooseMesh.h"
+#include "KDTree.h"
 // libMesh
 #include "libmesh/mesh_base.h"
 // System
@@ -27,6 +28,7 @@ class SlaveNeighborhoodThread
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
+                          const KDTree & master_tree,
                           std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -54,6 +56,9 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Spatial index over the positions of the trial master nodes (same ordering)
+  const KDTree & _master_tree;
+
   /// Node to elem map
   std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
 
@@ -18,6 +18,7 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "MaterialPropertyStorage.h"
+#include "ParallelUniqueId.h"
 
 //libMesh
 #include "libmesh/elem.h"
@@ -78,8 +79,8 @@ public:
 
   // material properties for given element (and possible side)
   void swap(const Elem & elem, unsigned int side = 0);
-  // Reinit material properties for given element (and possible side)
-  void reinit(std::vector<Material *> & mats);
+  // Reinit material properties for given element (and possible side) on thread tid
+  void reinit(std::vector<Material *> & mats, THREAD_ID tid);
   // material properties for given element (and possible side)
   void swapBack(const Elem & elem, unsigned int side = 0);
 
@@ -273,6 +274,7 @@ MaterialData::getPropertyOlder(const std::string & name)
 {
   unsigned int prop_id = _storage.getPropertyId(name);
   resizeProps<T>(prop_id);
+  _storage.requestPropertyOlder(name);
 
   MaterialProperty<T> * prop = dynamic_cast<MaterialProperty<T> *>(_props_older[prop_id]);
   if (prop != NULL)
@@ -90,14 +90,17 @@ template<>
 inline void
 dataStore(std::ostream & stream, PropertyValue * & p, void * /*context*/)
 {
-  p->store(stream);
+  // Time levels that are not stored for a property hold NULL and write nothing
+  if (p != NULL)
+    p->store(stream);
 }
 
 template<>
 inline void
 dataLoad(std::istream & stream, PropertyValue * & p, void * /*context*/)
 {
-  p->load(stream);
+  if (p != NULL)
+    p->load(stream);
 }
 
 
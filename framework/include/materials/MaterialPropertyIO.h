@@ -46,7 +46,26 @@ public:
   virtual void write(const std::string & file_name);
   virtual void read(const std::string & file_name);
 
+  /**
+   * Write this processor's stateful material properties into a stream
+   * @param out The stream receiving the same content write() puts in the file
+   */
+  void write(std::ostream & out);
+
 protected:
+  /**
+   * Write one time level of a storage
+   * @param state 0 for current, 1 for old and 2 for older properties
+   */
+  void storeProps(std::ostream & out, MaterialPropertyStorage & storage, unsigned int state);
+
+  /**
+   * Read one time level of a storage
+   * @param state 0 for current, 1 for old and 2 for older properties
+   * @param read_file_version The version of the file being read
+   */
+  void loadProps(std::istream & in, MaterialPropertyStorage & storage, unsigned int state, unsigned int read_file_version);
+
   FEProblem & _fe_problem;
   MooseMesh & _mesh;
   MaterialPropertyStorage & _material_props;
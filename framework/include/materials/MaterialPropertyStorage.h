@@ -17,14 +17,17 @@
 
 #include "Moose.h"
 #include "MaterialProperty.h"
-#include "HashMap.h"
 
 //libMesh
 #include "libmesh/elem.h"
 #include "libmesh/quadrature.h"
+#include "libmesh/threads.h"
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 #include <vector>
+#include <deque>
 #include <map>
+#include <set>
 #include <string>
 
 class Material;
@@ -34,16 +37,36 @@ class QpMap;
 /**
  * Stores the stateful material properties computed by materials.
  *
+ * Every element with stateful data gets a dense index (slot) the first time it is seen.  The
+ * data of all three time levels of an element lives in the same slot, so a single lookup serves
+ * the current, old and older properties, and shifting the time levels rotates the level indices
+ * instead of copying data.  The older level is only allocated for the properties that somebody
+ * declared or requested as older; the others keep two levels of data, which makes the shift hand
+ * their buffers back to the current level element by element.
+ *
+ * Slots are also indexed by element id, so once the table is sized for the mesh (see
+ * updateElemTable()) finding the data of an element that already has a slot does not lock.
+ *
  * Thread-safe
  */
 class MaterialPropertyStorage
 {
 public:
-  MaterialPropertyStorage();
+  /**
+   * @param boundary Whether this storage holds side data (one entry per element side) instead of
+   * elemental data (side 0 only)
+   */
+  MaterialPropertyStorage(bool boundary = false);
   virtual ~MaterialPropertyStorage();
 
   void releaseProperties();
 
+  /**
+   * Size the element id lookup table for the current mesh.  Must not be called from threads.
+   * @param max_elem_id One past the highest element id in the mesh
+   */
+  void updateElemTable(dof_id_type max_elem_id);
+
   /**
    * Creates storage for newly created elements from mesh Adaptivity.  Also, copies values from the parent qps to the new children.
    *
@@ -116,6 +139,10 @@ public:
    *
    * Old material properties become older, current material properties become old. Older material properties are
    * reused for computing current properties. This is called when solve succeeded.
+   *
+   * The time levels themselves are only rotated, but when some property has no older level its
+   * data is handed back to the current level element by element, which is linear in the number of
+   * stored elements.
    */
   void shift();
 
@@ -157,25 +184,132 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props() { return *_props_elem; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOld() { return *_props_elem_old; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOlder() { return *_props_elem_older; }
+  /**
+   * @return a Boolean indicating whether the older data of a stateful property is stored
+   * @param stateful_id Index into statefulProps()
+   */
+  bool hasOlderProperty(unsigned int stateful_id) const { return _stateful_prop_older[stateful_id]; }
+
+  /**
+   * Stateful data of an element in one of the time levels
+   * @param elem The element
+   * @param side Side number (elemental material properties have this equal to zero)
+   * @param state 0 for current, 1 for old and 2 for older properties
+   */
+  MaterialProperties & props(const Elem & elem, unsigned int side, unsigned int state);
+
+  MaterialProperties & props(const Elem & elem, unsigned int side) { return props(elem, side, 0); }
+  MaterialProperties & propsOld(const Elem & elem, unsigned int side) { return props(elem, side, 1); }
+  MaterialProperties & propsOlder(const Elem & elem, unsigned int side) { return props(elem, side, 2); }
+
+  /**
+   * The number of elements that have stateful data in this storage.  Slots are numbered
+   * densely in the order the elements were first seen.
+   */
+  unsigned int numElems() const { return _slot_elem.size(); }
+
+  /**
+   * The element stored in a slot
+   */
+  const Elem * slotElem(unsigned int slot) const { return _slot_elem[slot]; }
+
+  /**
+   * The number of sides that can be stored for the element in a slot
+   * @param slot The dense element index
+   */
+  unsigned int numSides(unsigned int slot) const { return _elem_props[slot]._sides.size(); }
+
+  /**
+   * Stateful data stored for the element in a slot.  Unlike props() this does not allocate
+   * anything.
+   * @return The data or NULL for sides that were never requested
+   */
+  MaterialProperties * slotProps(unsigned int slot, unsigned int side, unsigned int state);
 
   bool hasProperty(const std::string & prop_name) const;
   unsigned int addProperty(const std::string & prop_name);
   unsigned int addPropertyOld(const std::string & prop_name);
   unsigned int addPropertyOlder(const std::string & prop_name);
 
+  /**
+   * Record that the older data of a property is used.  Stateful properties only get an older
+   * level when it was declared or requested through here, which may happen before or after the
+   * property became stateful.
+   */
+  void requestPropertyOlder(const std::string & prop_name);
+
+  /**
+   * Bytes of stored data on this processor for every stateful property in each time level
+   * @param bytes Filled with one entry per stateful property holding the current, old and older sizes
+   */
+  void statefulPropBytes(std::vector<std::vector<std::size_t> > & bytes) const;
+
   std::vector<unsigned int> & statefulProps() { return _stateful_prop_id_to_prop_id; }
-  std::map<unsigned int, std::string> statefulPropNames() { return _prop_names; }
+  const std::vector<unsigned int> & statefulProps() const { return _stateful_prop_id_to_prop_id; }
+  std::map<unsigned int, std::string> statefulPropNames() const { return _prop_names; }
 
   unsigned int getPropertyId (const std::string & prop_name);
 
 protected:
-  // indexing: [element][side]->material_properties
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_old;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_older;
+  /**
+   * Stateful data of one element side for each of the three time levels.  Which level is
+   * current, old and older is decided by _state.
+   */
+  struct SideProperties
+  {
+    MaterialProperties _levels[3];
+  };
+
+  /**
+   * Stateful data of a single element.  The side pointers are sized when the slot is created
+   * (one for elemental data, one per side for boundary data), but a side only gets data once it
+   * is requested.
+   */
+  struct ElemProperties
+  {
+    const Elem * _elem;
+    std::vector<SideProperties *> _sides;
+  };
+
+  /**
+   * Find (or create) the slot holding the data of an element.  Elements that already have a
+   * slot and are covered by the element table are found without locking.
+   * @return The stateful data of the element (the reference stays valid when slots are added)
+   */
+  ElemProperties & elemProps(const Elem & elem);
+
+  /**
+   * Stateful data of an element on a side in one of the time levels, adding the side if needed.
+   * Sides that already have data are returned without locking.
+   */
+  MaterialProperties & levelProps(ElemProperties & elem_props, unsigned int state, unsigned int side);
+
+  /**
+   * Allocate the properties of one element side that have no data yet
+   * @param material_data The MaterialData providing the property types
+   * @param props The current data
+   * @param props_old The old data
+   * @param props_older The older data (only allocated for properties that need it)
+   * @param n_qpoints The number of quadrature points to allocate
+   */
+  void initProps(MaterialData & material_data, MaterialProperties & props, MaterialProperties & props_old, MaterialProperties & props_older, unsigned int n_qpoints);
+
+  /// Dense index of every element that has stateful data
+  LIBMESH_BEST_UNORDERED_MAP<const Elem *, unsigned int> _elem_slot;
+  /// The element in each slot
+  std::deque<const Elem *> _slot_elem;
+  /// Stateful data indexed by slot (a deque so references survive adding slots from other threads)
+  std::deque<ElemProperties> _elem_props;
+  /// Slot data by element id, NULL for elements without a slot (only resized by updateElemTable())
+  std::vector<ElemProperties *> _elem_table;
+  /// Guards slot creation, adding sides and allocation of the property data
+  Threads::spin_mutex _slot_mutex;
+
+  /// Whether the data is stored per element side
+  bool _boundary;
+
+  /// Position in ElemProperties::_levels of the current, old and older data
+  unsigned int _state[3];
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblem - should be useful when we will use material properties from
@@ -198,6 +332,10 @@ protected:
   std::map<unsigned int, std::string> _prop_names;
   /// the vector of stateful property ids (the vector index is the map to stateful prop_id)
   std::vector<unsigned int> _stateful_prop_id_to_prop_id;
+  /// Whether the older level is stored, indexed like _stateful_prop_id_to_prop_id
+  std::vector<bool> _stateful_prop_older;
+  /// Property ids whose older data was declared or requested
+  std::set<unsigned int> _older_requested;
 
   unsigned int addPropertyId (const std::string & prop_name);
 
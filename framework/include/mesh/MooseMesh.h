@@ -283,6 +283,22 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * getBoundaryElementRange();
 
+  /**
+   * Return a partition of the active local elements into "colors".  No two
+   * elements of the same color share a node, either directly or through a
+   * face neighbor, so their Jacobian contributions never touch the same
+   * matrix entries and may be inserted concurrently without locking.
+   * Elements that touch rows owned by another processor are left out of
+   * every color; see getActiveLocalElementUncoloredRange().
+   */
+  const std::vector<ConstElemRange *> & getActiveLocalElementColorRanges();
+
+  /**
+   * Return the active local elements that were not assigned a color because
+   * they (or their face neighbors) touch off-processor nodes.
+   */
+  ConstElemRange * getActiveLocalElementUncoloredRange();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -753,6 +769,14 @@ protected:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * _bnd_node_range;
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * _bnd_elem_range;
 
+  /// Active local elements grouped by color (see getActiveLocalElementColorRanges())
+  std::vector<ConstElemRange *> _active_local_elem_color_ranges;
+  /// Active local elements that could not be colored
+  ConstElemRange * _active_local_elem_uncolored_range;
+  /// The element vectors backing the color ranges (one per color, plus the uncolored one last)
+  std::vector<std::vector<Elem *> > _active_local_elem_colors;
+  bool _elem_coloring_built;
+
   /// A map of all of the current nodes to the elements that they are connected to.
   std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
   bool _node_to_elem_map_built;
@@ -833,6 +857,16 @@ protected:
   void freeBndNodes();
   void freeBndElems();
 
+  /**
+   * Build (or rebuild) the element coloring used by getActiveLocalElementColorRanges().
+   */
+  void buildActiveLocalElementColoring();
+
+  /**
+   * Free the element coloring ranges
+   */
+  void freeActiveLocalElementColoring();
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
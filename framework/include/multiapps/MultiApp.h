@@ -201,6 +201,12 @@ public:
    */
   bool isRootProcessor() { return _my_rank == 0; }
 
+  /**
+   * The wall time (in seconds) spent solving each App so far, indexed by global App number.
+   * This is collective on the communicator of this MultiApp.
+   */
+  std::vector<Real> appSolveTimes();
+
 protected:
   /**
    * _must_ fill in _positions with the positions of the sub-aps
@@ -222,6 +228,59 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Hand out contiguous groups of Apps so that every processor gets about the same
+   * total 'app_weights'.  Only used when there are at least as many Apps as processors.
+   */
+  void balanceAppsByWeight();
+
+  /**
+   * Split the Apps into contiguous groups of about the same total weight, one group per
+   * processor (every processor gets at least one App).
+   * @param weights The weight of each global App
+   * @param first_app Filled with the first App of each processor followed by the number of Apps
+   */
+  void partitionApps(const std::vector<Real> & weights, std::vector<unsigned int> & first_app);
+
+  /**
+   * Re-balance the Apps over the processors using their accumulated solve times as weights.
+   * An App that changes processor is deleted on the old processor and rebuilt on the new one
+   * from its restartable data and the state filled in by packAppState(); see appsRebalanced().
+   * This is collective on the communicator of this MultiApp.
+   */
+  void rebalanceApps();
+
+  /**
+   * Append the state an App needs to continue on another processor that is not restartable data.
+   * Called with the communicator of the App in place.
+   * @param local_app The local number of the App that is moving
+   * @param state The state to append to
+   */
+  virtual void packAppState(unsigned int local_app, std::vector<Real> & state);
+
+  /**
+   * Called after rebalanceApps() changed the local Apps, with the communicator of the Apps in place.
+   * The restartable data of the moved Apps is loaded after this returns.
+   * @param moved_in The state from packAppState() of each App that was just built on this
+   *                 processor, by local App number
+   */
+  virtual void appsRebalanced(const std::map<unsigned int, std::vector<Real> > & moved_in);
+
+  /**
+   * Add the cost of a solve to the accumulated cost of an App.  This is the solve time unless
+   * 'app_cost_postprocessor' is set, in which case the value of that postprocessor of the App is
+   * used.  Called with the communicator of the App in place.
+   * @param local_app The local number of the App that solved
+   * @param solve_time The wall time the solve took
+   */
+  void addAppCost(unsigned int local_app, Real solve_time);
+
+  /**
+   * Print the accumulated solve time of every App if 'report_app_solve_times' is set.
+   * This is collective on the communicator of this MultiApp.
+   */
+  void reportAppSolveTimes();
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -311,6 +370,24 @@ protected:
 
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
+
+  /// The relative cost of each App, used to balance the Apps over the processors
+  std::vector<Real> _app_weights;
+
+  /// Whether or not to print the App solve times after each solve
+  bool _report_app_solve_times;
+
+  /// Accumulated wall time spent solving each local App (or the accumulated 'app_cost_postprocessor' values)
+  std::vector<Real> _app_solve_time;
+
+  /// The number of solves between re-balancing the Apps (0 for never)
+  unsigned int _rebalance_interval;
+
+  /// The number of solves since the Apps were last balanced
+  unsigned int _n_solves;
+
+  /// The postprocessor of the Apps used as their cost instead of the solve time (empty if not set)
+  PostprocessorName _app_cost_postprocessor;
 };
 
 #endif // MULTIAPP_H
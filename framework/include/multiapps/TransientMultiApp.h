@@ -78,6 +78,18 @@ public:
    */
   virtual void resetApp(unsigned int global_app, Real time);
 
+protected:
+  /**
+   * Packs the current, old and older solutions of the App, the rest of its state is moved as
+   * restartable data.  The state of Apps using adaptivity or stateful material properties can not be moved.
+   */
+  virtual void packAppState(unsigned int local_app, std::vector<Real> & state);
+
+  /**
+   * Picks up the Executioners of the rebalanced Apps and restores the state of the moved ones
+   */
+  virtual void appsRebalanced(const std::map<unsigned int, std::vector<Real> > & moved_in);
+
 private:
   /**
    * Setup the executioner for the local app.
@@ -23,7 +23,11 @@
 #include "MaterialPropertyIO.h"
 #include "RestartableDataIO.h"
 
+// libMesh includes
+#include "libmesh/threads.h"
+
 #include <deque>
+#include <list>
 
 // Forward declarations
 class Checkpoint;
@@ -48,6 +52,47 @@ struct CheckpointFileNames
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Restartable data filename of the complete checkpoint that restart refers to (empty if restart is complete)
+  std::string restart_base;
+};
+
+/**
+ * An in-memory copy of the restartable data and stateful material properties of a checkpoint,
+ * written to disk on a background thread
+ */
+struct CheckpointSnapshot
+{
+  CheckpointSnapshot();
+
+  /**
+   * Write the buffers to their files, this runs on the background thread
+   */
+  void write();
+
+  /// The files belonging to this checkpoint
+  CheckpointFileNames files;
+
+  /// Where the files are written, they are renamed to files once the whole checkpoint is on disk
+  CheckpointFileNames temp_files;
+
+  /// File receiving the restartable data section
+  std::string restart_file;
+
+  /// Position of this processor's section within restart_file
+  unsigned long long restart_offset;
+
+  /// The serialized restartable data
+  std::string restart_buffer;
+
+  /// File receiving the material properties (empty if there are no stateful properties)
+  std::string material_file;
+
+  /// The serialized material properties
+  std::string material_buffer;
+
+  /// Set by write() if any of the files could not be written
+  bool failed;
 };
 
 /**
@@ -86,10 +131,47 @@ public:
    */
   std::string directory();
 
+  /**
+   * Wait for the checkpoint being written in the background (if any), move it into place and
+   * remove the files it replaces.  This is collective.
+   */
+  void flush();
+
 protected:
 
+  /**
+   * Flushes the background write before the simulation can end or retry a step
+   */
+  virtual void outputStep(const ExecFlagType & type);
+
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Remove the retired restartable data files that no remaining checkpoint refers to
+   */
+  void removeUnreferencedRestartFiles();
+
+  /**
+   * Snapshot the restartable data and material properties and write them on a background thread
+   * @param file_struct The final names of the checkpoint files
+   * @param temp_file_struct The names the files are written to (the mesh and system files are already there)
+   */
+  void writeInBackground(const CheckpointFileNames & file_struct, const CheckpointFileNames & temp_file_struct);
+
+  /**
+   * Directory the background writes go to until the whole checkpoint is on disk.  It is
+   * a sub-directory so that recover never picks up a checkpoint that is still being written.
+   */
+  std::string tempDirectory();
+
+  /**
+   * Complete the pending background write: wait for it, check it succeeded on all processors
+   * and rename its files into place.  This is collective.
+   * @param message Filled with the reason when the checkpoint could not be written
+   * @return false if the checkpoint could not be written
+   */
+  bool finishBackgroundWrite(std::string & message);
+
 private:
 
   /// Max no. of output files to store
@@ -119,6 +201,24 @@ private:
   /// RestrableData input/output interface
   RestartableDataIO _restartable_data_io;
 
+  /// Number of processors sharing a restartable data file
+  unsigned int _processors_per_file;
+
+  /// Retired restartable data files that are kept because a delta checkpoint refers to them
+  std::list<std::string> _retired_restart_files;
+
+  /// True if the restartable data and material properties are written on a background thread
+  bool _background_write;
+
+  /// Snapshots larger than this (in bytes) are written before the simulation continues
+  std::size_t _background_memory_limit;
+
+  /// The snapshot being written in the background
+  CheckpointSnapshot * _pending_snapshot;
+
+  /// The thread writing _pending_snapshot
+  Threads::Thread * _writer_thread;
+
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
 };
@@ -208,6 +208,9 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// State for the per-object timing table
+  bool _object_perf_log;
+
   /// Flag for writing all variable norms
   bool _all_variable_norms;
 
@@ -62,6 +62,11 @@ public:
    */
   virtual void meshChanged();
 
+  /**
+   * Append to the file the App wrote before it moved, like when recovering
+   */
+  virtual void appMoved();
+
   /**
    * Performs the necessary deletion and re-creating of ExodusII_IO object
    *
@@ -149,7 +154,7 @@ private:
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
-  /// Flag indicating MOOSE is recovering via --recover command-line option
+  /// Flag indicating MOOSE is recovering via --recover command-line option (or the App moved), the next file is appended to
   bool _recovering;
 
   /// Storage for input file record; this is written to the file only after it has been initialized
@@ -47,6 +47,12 @@ public:
    */
   virtual ~MaterialPropertyDebugOutput();
 
+  /**
+   * Prints the memory used by the stateful material properties, which is only known once they
+   * have been initialized
+   */
+  virtual void initialSetup();
+
 protected:
 
   /**
@@ -67,6 +73,13 @@ protected:
    */
   void printMaterialProperties(std::stringstream & output, const std::vector<Material * > & materials) const;
 
+  /**
+   * Builds an output stream with the bytes stored per time level for each stateful property
+   * @param output The output stream to populate
+   * @param storage The stateful property storage to report on
+   */
+  void printStatefulMemory(std::stringstream & output, const MaterialPropertyStorage & storage) const;
+
 };
 
 #endif // MATERIALPROPERTYEBUGOUTPUT_H
@@ -116,6 +116,12 @@ protected:
    */
   virtual void timestepSetupInternal();
 
+  /**
+   * Called after the App was rebuilt on another processor and loaded the restartable data of the
+   * old App (see MultiApp rebalance_interval), so that the output can continue where it left off
+   */
+  virtual void appMoved();
+
   /**
    * Handles logic for determining if a step should be output
    * @return True if a call if output should be preformed
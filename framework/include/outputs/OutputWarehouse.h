@@ -82,6 +82,11 @@ public:
    */
   void meshChanged();
 
+  /**
+   * Calls the appMoved method for every output object
+   */
+  void appMoved();
+
   /**
    * Return the list of hidden variables for the given output name
    * @param output_name The name of the output object for which the variables should be returned
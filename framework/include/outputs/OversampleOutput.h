@@ -43,6 +43,10 @@ InputParameters validParams<OversampleOutput>();
  * The use of oversampling is triggered by setting the oversample input parameter to a
  * integer value greater than 0, indicating the number of refinements to perform.
  *
+ * By default the source solution is serialized to every processor and sampled with MeshFunction
+ * objects. The distributed path instead locates each local oversampled node in the source mesh
+ * once, stores the interpolation weights and only ghosts the source dofs these weights refer to.
+ *
  * @see Exodus
  */
 class OversampleOutput :
@@ -112,6 +116,32 @@ private:
    */
   void cloneMesh();
 
+  /**
+   * Locate the local oversampled nodes in the source mesh and compute the interpolation weights
+   * and ghosted source dofs used by the distributed path
+   */
+  void buildOversampleMap();
+
+  /**
+   * Update the oversampled solution without serializing the source solution
+   */
+  void updateDistributedOversample();
+
+  /**
+   * The interpolation of one oversampled dof from the source solution
+   */
+  struct OversampleEntry
+  {
+    /// The dof of the oversampled system receiving the value
+    dof_id_type _dest_dof;
+
+    /// The source dofs the value is interpolated from
+    std::vector<dof_id_type> _source_dofs;
+
+    /// The shape function values at the oversampled node, one per source dof
+    std::vector<Real> _weights;
+  };
+
   /**
    * A vector of pointers to the mesh functions
    * This is only populated when the oversample() function is called, it must
@@ -130,6 +160,18 @@ private:
    * and variable before the MeshFunction is applied. This allows for the same MeshFunction object to be
    * re-used, unless the mesh has changed due to adaptivity */
   AutoPtr<NumericVector<Number> > _serialized_solution;
+
+  /// True if the distributed path is used instead of serializing the solution
+  bool _distributed;
+
+  /// The interpolation entries of the local oversampled dofs, one vector per system
+  std::vector<std::vector<OversampleEntry> > _oversample_entries;
+
+  /// The source dofs not owned by this processor that the interpolation needs, one vector per system
+  std::vector<std::vector<dof_id_type> > _ghost_dofs;
+
+  /// Source solution vectors holding the local and ghosted dofs, one per system
+  std::vector<NumericVector<Number> *> _ghosted_solutions;
 };
 
 #endif // OVERSAMPLEOUTPUT_H
@@ -0,0 +1,93 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TRACEOUTPUT_H
+#define TRACEOUTPUT_H
+
+// MOOSE includes
+#include "BasicOutput.h"
+#include "FileOutput.h"
+
+// Forward declerations
+class TraceOutput;
+
+template<>
+InputParameters validParams<TraceOutput>();
+
+/**
+ * Writes a timeline of the run in the Chrome trace event format, one file per processor.
+ *
+ * Creating this output enables Moose::trace_log, which records the Moose::perf_log events of
+ * the solve, the threaded element and node loops, MultiApp solves and Transfers.  This output
+ * adds a span for each nonlinear and linear iteration.  The per-processor files are combined
+ * with framework/scripts/merge_traces.py and can be viewed in chrome://tracing or Perfetto.
+ */
+class TraceOutput : public BasicOutput<FileOutput>
+{
+public:
+
+  /**
+   * Class constructor
+   */
+  TraceOutput(const std::string & name, InputParameters & parameters);
+
+  /**
+   * Writes out the events still buffered by Moose::trace_log
+   */
+  virtual ~TraceOutput();
+
+  /**
+   * The file of this processor
+   * @return <file_base>.trace.<rank>.json
+   */
+  virtual std::string filename();
+
+protected:
+
+  /**
+   * Records the iteration spans
+   */
+  virtual void output(const ExecFlagType & type);
+
+  /**
+   * Ends the open linear iteration span, if any
+   */
+  void endLinearIteration();
+
+  /**
+   * Ends the open nonlinear and linear iteration spans, if any
+   */
+  void endNonlinearIteration();
+
+  /// True if this output enabled Moose::trace_log (false in a sub-application whose parent did)
+  bool _owns_trace;
+
+  /// True while a nonlinear iteration span is open
+  bool _nonlinear_open;
+
+  /// Start time and initial residual norm of the open nonlinear iteration
+  Real _nonlinear_start;
+  Real _nonlinear_norm;
+  int _nonlinear_its;
+
+  /// True while a linear iteration span is open
+  bool _linear_open;
+
+  /// Start time and initial residual norm of the open linear iteration
+  Real _linear_start;
+  Real _linear_norm;
+  int _linear_its;
+};
+
+#endif /* TRACEOUTPUT_H */
@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPERFORMANCEDATA_H
+#define OBJECTPERFORMANCEDATA_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class ObjectPerformanceData;
+
+template<>
+InputParameters validParams<ObjectPerformanceData>();
+
+/**
+ * Reports the timing of one object (or of all objects with a given name) of this app
+ * recorded by Moose::object_perf_log.  Creating this postprocessor turns the per-object timing on.
+ */
+class ObjectPerformanceData : public GeneralPostprocessor
+{
+public:
+  ObjectPerformanceData(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * This will return the requested column of the selected category.  For "all" the
+   * categories are added up, and max_processor_time is the largest time one processor
+   * spent in the object over all categories.
+   */
+  virtual Real getValue();
+
+protected:
+  MooseEnum _column;
+
+  /// The name of the object to report
+  std::string _object;
+
+  /// The category to report, "all" to add up every category
+  MooseEnum _category;
+};
+
+#endif // OBJECTPERFORMANCEDATA_H
@@ -19,6 +19,8 @@
 
 #include <string>
 #include <list>
+#include <vector>
+#include <map>
 
 class RestartableDatas;
 
@@ -28,6 +30,18 @@ class FEProblem;
  * Class for doing restart.
  *
  * It takes care of writing and reading the restart files.
+ *
+ * Each processor writes a single section holding the data of all of its threads.  An index of
+ * names, offsets and sizes is appended to the section so that restart can seek straight to the
+ * values it needs.  A processor with a file of its own streams its section straight into it.
+ * Several processors can share one file (see setProcessorsPerFile()): each one serializes its
+ * section into memory, the section offsets follow from an exclusive scan of the section sizes
+ * and all sections are written at the same time.  The file header holds a table of
+ * the section offsets, so every processor reads its own section without looking at the others.
+ *
+ * With setFullCheckpointInterval() only every n-th section is complete.  The others are deltas
+ * that hold the values whose serialized bytes changed since the last complete section and refer
+ * to that section for all the others.
  */
 class RestartableDataIO
 {
@@ -41,6 +55,38 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serialize this processor's section of the restartable data into memory so that it can be
+   * written later, possibly from another thread, with writeRestartableDataBuffer().
+   * This agrees on the section offsets with the other processors sharing the file and creates
+   * the file with its header.  It is collective on the processors sharing the file.
+   * @param base_file_name The base name of the restartable data files
+   * @param restartable_datas The data to serialize
+   * @param buffer Filled with the serialized section
+   * @param section_start Filled with the position of the section within the file
+   * @return The name of the file the section belongs to
+   */
+  std::string bufferRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::string & buffer, unsigned long long & section_start);
+
+  /**
+   * Write a section serialized by bufferRestartableData().
+   * This does not communicate or touch any MOOSE objects, so it is safe to call from a background thread.
+   * @return false if the write failed
+   */
+  static bool writeRestartableDataBuffer(const std::string & file_name, unsigned long long section_start, const std::string & buffer);
+
+  /**
+   * Serialize all of the restartable data of a problem, for moving it into another instance of
+   * the same problem with deserializeRestartableData().  The values go through the same
+   * dataStore() path as a checkpoint.
+   */
+  static void serializeRestartableData(FEProblem & fe_problem, std::ostream & stream);
+
+  /**
+   * Load the restartable data written by serializeRestartableData() into a problem built from the same input.
+   */
+  static void deserializeRestartableData(FEProblem & fe_problem, std::istream & stream);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
    */
@@ -51,12 +97,178 @@ public:
    */
   void readRestartableData(RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Set the number of processors that write their sections into the same file.
+   * @param processors_per_file Number of consecutive processor ids sharing a file (must be > 0)
+   */
+  void setProcessorsPerFile(unsigned int processors_per_file);
+
+  /**
+   * The name of the file holding the restartable data for a processor.
+   * @param base_file_name The base name passed to writeRestartableData()
+   * @param proc_id The processor id
+   * @param processors_per_file The number of processors sharing each file
+   */
+  static std::string fileName(const std::string & base_file_name, processor_id_type proc_id, unsigned int processors_per_file);
+
+  /**
+   * Write a complete section every n-th time and deltas against it otherwise.
+   * @param interval Number of writes between complete sections, 1 disables deltas
+   */
+  void setFullCheckpointInterval(unsigned int interval);
+
+  /**
+   * The base file name of the complete checkpoint that the last written section refers to,
+   * this is empty if the last section was complete itself.
+   */
+  const std::string & lastFullCheckpoint() const { return _last_full_checkpoint; }
+
 private:
+  /**
+   * Header written at the beginning of each processor section
+   */
+  struct SectionHeader
+  {
+    processor_id_type _proc_id;
+
+    /// Size of the whole section (header, data and index) in bytes
+    unsigned long long _section_size;
+
+    /// Position of the index relative to the beginning of the section
+    unsigned long long _index_offset;
+
+    /// Base file name (without the directory) of the complete checkpoint a delta refers to, empty otherwise
+    std::string _base_name;
+  };
+
+  /**
+   * Location of a single value within a processor section
+   */
+  struct DataIndexEntry
+  {
+    std::string _name;
+
+    /// Position of the value relative to the beginning of the section
+    unsigned long long _offset;
+
+    /// Number of bytes written by RestartableDataValue::store()
+    unsigned long long _size;
+
+    /// True if the value is unchanged and lives in the section of the complete checkpoint
+    bool _in_base;
+  };
+
+  /**
+   * A value written to the last complete section, used to decide what a delta has to contain
+   */
+  struct StoredValue
+  {
+    /// Hash of the serialized bytes
+    unsigned long long _hash;
+
+    /// Position of the value relative to the beginning of the complete section
+    unsigned long long _offset;
+
+    /// Number of bytes of the value
+    unsigned long long _size;
+  };
+
+  /**
+   * Write this processor's section (header, values and index) at the current position of a stream.
+   * @return The size of the section in bytes
+   */
+  unsigned long long writeSection(std::ostream & out, const std::string & base_file_name, const RestartableDatas & restartable_datas);
+
+  /**
+   * Open the file holding this processor's section and position it at the beginning of the section.
+   * @param base_file_name The base name of the restartable data files
+   * @param processors_per_file The number of processors sharing each file
+   * @param section_start Filled with the position of the section within the file
+   * @param header Filled with the header of the section
+   * @return The opened file, owned by the caller
+   */
+  std::ifstream * openSection(const std::string & base_file_name, unsigned int processors_per_file, unsigned long long & section_start, SectionHeader & header);
+
+  /**
+   * The range of processors sharing a file with this processor.
+   */
+  void fileGroup(processor_id_type & first_proc, processor_id_type & last_proc) const;
+
+  /**
+   * The communicator of the processors sharing a file with this processor, split off the
+   * communicator of the problem the first time it is needed (collective then).
+   */
+  MPI_Comm fileGroupComm();
+
+  /**
+   * Find the position of this processor's section from the section sizes of all processors sharing the file.
+   * @param section_size The size of this processor's section
+   * @param section_starts Filled with the position of every section of the file on the first processor of the file
+   * @return The position of this processor's section
+   */
+  unsigned long long sectionStart(unsigned long long section_size, std::vector<unsigned long long> & section_starts);
+
+  /**
+   * The size of the file header for a file holding the given number of sections.
+   */
+  static unsigned long long fileHeaderSize(unsigned int n_sections);
+
+  /**
+   * Write the file header holding the layout of the run and the section offset table.
+   */
+  void writeFileHeader(std::ostream & out, const std::vector<unsigned long long> & section_starts);
+
+  /**
+   * Read the file header, check it against the current run and load the section offset table.
+   */
+  void readFileHeader(std::istream & in, unsigned int & processors_per_file, std::vector<unsigned long long> & section_starts);
+
+  /**
+   * Read a section header and check that it belongs to this processor.
+   */
+  void readSectionHeader(std::istream & in, SectionHeader & header);
+
   /// Reference to a FEProblem being restarted
   FEProblem & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<std::ifstream *> _in_file_handles;
+  /// Number of processors sharing one file when writing
+  unsigned int _processors_per_file;
+
+  /// Number of writes between complete sections
+  unsigned int _full_checkpoint_interval;
+
+  /// Number of sections written so far
+  unsigned int _n_written;
+
+  /// The base file name of the last complete section written
+  std::string _full_checkpoint;
+
+  /// The values of the last complete section written, one map per thread
+  std::vector<std::map<std::string, StoredValue> > _full_values;
+
+  /// The complete checkpoint the last written section refers to (empty if it was complete)
+  std::string _last_full_checkpoint;
+
+  /// The file handle for reading this processor's section
+  std::ifstream * _in_file_handle;
+
+  /// Position of this processor's section within the file being read
+  unsigned long long _section_start;
+
+  /// Index of the values in this processor's section, one vector per thread
+  std::vector<std::vector<DataIndexEntry> > _data_index;
+
+  /// The file handle for reading the complete section a delta refers to
+  std::ifstream * _base_file_handle;
+
+  /// Position of the complete section within the file it is read from
+  unsigned long long _base_section_start;
+
+  /// Communicator of the processors sharing a file (MPI_COMM_NULL until needed)
+  MPI_Comm _file_group_comm;
+
+  /// The number of processors per file _file_group_comm was split for
+  unsigned int _file_group_size;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
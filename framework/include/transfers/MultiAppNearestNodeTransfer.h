@@ -16,6 +16,7 @@
 #define MULTIAPPNEARESTNODETRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 class MooseVariable;
 class MultiAppNearestNodeTransfer;
@@ -31,22 +32,48 @@ class MultiAppNearestNodeTransfer :
 {
 public:
   MultiAppNearestNodeTransfer(const std::string & name, InputParameters parameters);
-  virtual ~MultiAppNearestNodeTransfer() {}
+  virtual ~MultiAppNearestNodeTransfer();
 
   virtual void initialSetup();
 
   virtual void execute();
 
 protected:
+  /**
+   * A spatial index over a set of nodes of one source mesh.
+   */
+  struct NodeSearchTree
+  {
+    NodeSearchTree() : _tree(NULL) {}
+    ~NodeSearchTree() { delete _tree; }
+
+    /// The positions of the indexed nodes
+    std::vector<Point> _points;
+    /// The indexed nodes, in the same order as _points
+    std::vector<Node *> _nodes;
+    /// The tree built over _points
+    KDTree * _tree;
+  };
+
+  /**
+   * Return the (cached) spatial index over the nodes in [nodes_begin, nodes_end) of from_mesh.
+   * The index is rebuilt on every execute() unless fixed_meshes is set.
+   */
+  const NodeSearchTree & getSearchTree(const MeshBase & from_mesh,
+                                       const MeshBase::const_node_iterator & nodes_begin,
+                                       const MeshBase::const_node_iterator & nodes_end);
+
   /**
    * Return the nearest node to the point p.
    * @param p The point you want to find the nearest node to.
    * @param distance This will hold the distance between the returned node and p
-   * @param nodes_begin - iterator to the beginning of the node list
-   * @param nodes_end - iterator to the end of the node list
+   * @param search_tree - the spatial index over the candidate nodes
    * @return The Node closest to point p.
    */
-  Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
+  Node * getNearestNode(const Point & p, Real & distance, const NodeSearchTree & search_tree);
+
+  /// Delete all cached search trees
+  void clearSearchTrees();
 
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
@@ -57,11 +84,14 @@ protected:
   /// If true then node connections will be cached
   bool _fixed_meshes;
 
-  /// Used to cache nodes
-  std::map<dof_id_type, Node *> _node_map;
+  /// Used to cache nodes, indexed by (app number, target node or element id)
+  std::map<std::pair<unsigned int, dof_id_type>, Node *> _node_map;
+
+  /// Used to cache distances, indexed by (app number, target node or element id)
+  std::map<std::pair<unsigned int, dof_id_type>, Real> _distance_map;
 
-  /// Used to cache distances
-  std::map<dof_id_type, Real> _distance_map;
+  /// Spatial indices over the source meshes
+  std::map<const MeshBase *, NodeSearchTree *> _search_trees;
 };
 
 #endif /* MULTIAPPVARIABLEVALUESAMPLEPOSTPROCESSORTRANSFER_H */
@@ -25,6 +25,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 #include <ostream>
 #include <fstream>
 
@@ -104,6 +105,20 @@ public:
    */
   void setPrecision(unsigned int precision){ _csv_precision = precision; }
 
+  /**
+   * By default printCSV rewrites the whole file, this makes it append the new rows instead.
+   * Only the last row written before is rewritten (its values may have been updated) and the
+   * whole file is only rewritten when columns are added.  Aligned or interval output always
+   * rewrites the file.
+   */
+  void setAppendOnly(bool append_only){ _append_only = append_only; }
+
+  /**
+   * Limit the number of rows kept in memory once they are written by the append only printCSV,
+   * older rows are only kept in the file.  A value of zero keeps all rows.
+   */
+  void setMaxRows(unsigned int max_rows){ _max_rows = max_rows; }
+
 
 protected:
   void printTablePiece(std::ostream & out, unsigned int last_n_entries, std::map<std::string, unsigned short> & col_widths,
@@ -124,6 +139,32 @@ protected:
    */
   unsigned short getTermWidth(bool use_environment) const;
 
+  /**
+   * The append only version of printCSV
+   */
+  void appendCSV(const std::string & file_name);
+
+  /**
+   * Write the header line of the csv file
+   */
+  void printCSVHeader(std::ostream & out);
+
+  /**
+   * Write a single row of the csv file
+   */
+  void printCSVRow(std::ostream & out, std::map<Real, std::map<std::string, Real> >::iterator & row);
+
+  /**
+   * Read the column names from the header of the existing csv file
+   * @return false if the file could not be read
+   */
+  bool readCSVHeader(std::vector<std::string> & columns);
+
+  /**
+   * Parse the rows that were dropped from memory back from the csv file
+   */
+  void loadDroppedRows();
+
   /**
    * Data structure for the console table
    * The first map creates an association from the independent variable (normally time)
@@ -159,6 +200,27 @@ private:
   /// *.csv file precision, defaults to 14
   unsigned int _csv_precision;
 
+  /// Append new rows to the *.csv file instead of rewriting it
+  bool _append_only;
+
+  /// Number of written rows kept in memory (0 keeps all of them)
+  unsigned int _max_rows;
+
+  /// Number of columns in the header of the *.csv file
+  unsigned int _csv_n_columns;
+
+  /// File positions of the rows that are both in the *.csv file and in memory
+  std::map<Real, unsigned long long> _csv_row_positions;
+
+  /// Set when a row is added before the last row written, which requires rewriting the file
+  bool _csv_needs_rewrite;
+
+  /// True if rows were dropped from memory after being written to the *.csv file
+  bool _rows_dropped;
+
+  /// File position of the first row held in memory when rows were dropped
+  unsigned long long _csv_first_row_pos;
+
   friend void dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
 };
@@ -0,0 +1,92 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+
+/**
+ * A static k-d tree over a set of points used to answer nearest neighbor
+ * queries in logarithmic time.  The tree keeps indices into the point list
+ * it was built from and never copies the points themselves, so the list must
+ * outlive the tree.  Queries are const and may be made from several threads
+ * at once.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param points The points to build the tree over
+   * @param max_leaf_size The maximum number of points stored in a leaf of the tree
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  virtual ~KDTree();
+
+  /**
+   * Find the (up to) patch_size points closest to query_point.
+   * @param query_point The point to search around
+   * @param patch_size The number of points to return
+   * @param return_index Indices (into the original point list) of the closest points, sorted by increasing distance
+   */
+  void neighborSearch(const Point & query_point, unsigned int patch_size, std::vector<unsigned int> & return_index) const;
+
+  /**
+   * The number of points in the tree
+   */
+  unsigned int size() const { return _index.size(); }
+
+protected:
+  /// A node of the tree.  Leaves hold the range [_begin, _end) of _index.
+  struct TreeNode
+  {
+    unsigned int _begin;
+    unsigned int _end;
+    unsigned int _left;
+    unsigned int _right;
+    unsigned int _split_dim;
+    Real _split_value;
+  };
+
+  /// Recursively build the subtree holding _index[begin, end) and return its node number
+  unsigned int build(unsigned int begin, unsigned int end);
+
+  /// Recursively search the subtree rooted at node, keeping the closest points in a max heap
+  void search(unsigned int node, const Point & query_point, unsigned int patch_size,
+              std::vector<std::pair<Real, unsigned int> > & heap) const;
+
+  /// The points the tree was built over
+  const std::vector<Point> & _points;
+
+  /// The maximum number of points in a leaf
+  const unsigned int _max_leaf_size;
+
+  /// Point indices, ordered so that every tree node holds a contiguous range
+  std::vector<unsigned int> _index;
+
+  /// The tree nodes, the root is the first one
+  std::vector<TreeNode> _nodes;
+
+  /// Marks a TreeNode without children
+  static const unsigned int INVALID_NODE;
+};
+
+#endif // KDTREE_H
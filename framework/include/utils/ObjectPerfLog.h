@@ -0,0 +1,181 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPERFLOG_H
+#define OBJECTPERFLOG_H
+
+#include "ParallelUniqueId.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class MooseApp;
+class MooseObject;
+
+/**
+ * Wall time spent in the individual MooseObjects called from the threaded loops
+ * (kernels, BCs, materials, user objects and aux kernels).
+ *
+ * Timing is off until enable() is called.  Each thread then accumulates into its own
+ * table, so no locking is needed while timing.  The tables of all threads and
+ * processors are combined when a summary is requested.
+ *
+ * The log is shared by all the MooseApps of a process (the master and its MultiApps), so
+ * each counter remembers the app of its object and the summaries only combine the
+ * objects of one app.
+ */
+class ObjectPerfLog
+{
+public:
+  /// The loops that objects are timed in
+  enum Category
+  {
+    RESIDUAL = 0,
+    JACOBIAN,
+    MATERIAL,
+    USER_OBJECT,
+    AUX_KERNEL,
+    N_CATEGORIES
+  };
+
+  /// Combined timing of one object in one category
+  struct Entry
+  {
+    /// Name of the object
+    std::string _name;
+
+    /// The loop the object was called in, N_CATEGORIES for all of them
+    Category _category;
+
+    /// Number of calls, summed over threads and processors
+    Real _n_calls;
+
+    /// Time in seconds, summed over threads and processors
+    Real _time;
+
+    /// The largest time in seconds spent on one processor
+    Real _max_time;
+  };
+
+  ObjectPerfLog();
+
+  /**
+   * Turns on timing.  This must be called outside of the threaded loops.
+   */
+  void enable();
+
+  /**
+   * Whether timing is on
+   */
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Adds one call of an object
+   * @param obj The object that was called
+   * @param category The loop it was called in
+   * @param elapsed The wall time of the call in seconds
+   * @param tid The thread the call was made on
+   */
+  void add(const MooseObject * obj, Category category, Real elapsed, THREAD_ID tid);
+
+  /**
+   * Combines the timings of the objects of one app over all threads and processors, sorted
+   * by decreasing total time.  This is collective on comm, the communicator of the app.
+   */
+  std::vector<Entry> summary(const Parallel::Communicator & comm, const MooseApp & app) const;
+
+  /**
+   * Combines the timings of one object over all categories, threads and processors.  The
+   * _max_time of the result is the largest time one processor spent in the object, summed
+   * over the categories before the maximum is taken.  Its _category is N_CATEGORIES.
+   * This is collective on comm, the communicator of the app.
+   */
+  Entry objectTotal(const Parallel::Communicator & comm, const MooseApp & app, const std::string & name) const;
+
+  /**
+   * Formatted table of summary().  This is collective on comm.
+   * @param max_rows The number of objects to list, 0 for all of them
+   */
+  std::string table(const Parallel::Communicator & comm, const MooseApp & app, unsigned int max_rows = 0) const;
+
+  /**
+   * The name of a category, as used in the table
+   */
+  static std::string categoryName(Category category);
+
+  /**
+   * The current wall time in seconds
+   */
+  static Real wallTime();
+
+protected:
+  /// The data one thread accumulates for one object
+  struct Counter
+  {
+    Counter() : _app(NULL), _n_calls(0), _time(0.) {}
+
+    std::string _name;
+    const MooseApp * _app;
+    unsigned long _n_calls;
+    Real _time;
+  };
+
+  typedef std::pair<const MooseObject *, Category> Key;
+
+  /// Whether timing is on
+  bool _enabled;
+
+  /// The counters of each thread
+  std::vector<std::map<Key, Counter> > _counters;
+};
+
+/**
+ * Adds the wall time between its construction and destruction to an ObjectPerfLog,
+ * if the log is enabled:
+ *
+ *   {
+ *     ObjectPerfTimer timer(Moose::object_perf_log, kernel, ObjectPerfLog::RESIDUAL, _tid);
+ *     kernel->computeResidual();
+ *   }
+ */
+class ObjectPerfTimer
+{
+public:
+  ObjectPerfTimer(ObjectPerfLog & log, const MooseObject * obj, ObjectPerfLog::Category category, THREAD_ID tid) :
+      _log(log),
+      _obj(obj),
+      _category(category),
+      _tid(tid),
+      _start(log.enabled() ? ObjectPerfLog::wallTime() : -1.)
+  {
+  }
+
+  ~ObjectPerfTimer()
+  {
+    if (_start >= 0.)
+      _log.add(_obj, _category, ObjectPerfLog::wallTime() - _start, _tid);
+  }
+
+protected:
+  ObjectPerfLog & _log;
+  const MooseObject * _obj;
+  ObjectPerfLog::Category _category;
+  THREAD_ID _tid;
+
+  /// The wall time at construction, negative if the log is disabled
+  Real _start;
+};
+
+#endif // OBJECTPERFLOG_H
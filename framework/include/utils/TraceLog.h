@@ -0,0 +1,202 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TRACELOG_H
+#define TRACELOG_H
+
+#include "ParallelUniqueId.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Records timestamped begin/end events for a timeline of the run, written in the
+ * Chrome trace event format (viewable in chrome://tracing or Perfetto).
+ *
+ * Each processor writes its own file, in which the process id is the rank and the thread
+ * id is the MOOSE thread id.  Events are buffered per thread and the buffer of a thread is
+ * appended to the file whenever it holds buffer_size events, so memory use is bounded
+ * however long the run is.  The files of all processors are merged offline with
+ * framework/scripts/merge_traces.py.
+ *
+ * The log records nothing until enable() is called.
+ */
+class TraceLog
+{
+public:
+  TraceLog();
+
+  /**
+   * Writes out any events that are still buffered
+   */
+  ~TraceLog();
+
+  /**
+   * Starts recording into file_name.  This is collective on comm: the processors are
+   * synchronized so that their timestamps share the same origin.
+   * @return false if the log was already enabled, in which case nothing changes
+   */
+  bool enable(const std::string & file_name, unsigned int buffer_size, const Parallel::Communicator & comm);
+
+  /**
+   * Whether events are being recorded
+   */
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Starts a span.  Spans on the same thread must be properly nested.
+   */
+  void begin(const std::string & name, const std::string & category, THREAD_ID tid = 0);
+
+  /**
+   * Ends the span started by the matching begin()
+   */
+  void end(const std::string & name, const std::string & category, THREAD_ID tid = 0);
+
+  /**
+   * Records a span whose extent is already known
+   * @param start The start of the span as returned by time()
+   * @param args JSON members attached to the event, e.g. "\"norm\": 1e-5", or empty
+   */
+  void complete(const std::string & name, const std::string & category, Real start, const std::string & args = "", THREAD_ID tid = 0);
+
+  /**
+   * Seconds since the log was enabled
+   */
+  Real time() const;
+
+  /**
+   * Writes out all buffered events and closes the file.  This must not be called
+   * from inside a threaded loop.
+   */
+  void finalize();
+
+protected:
+  /// One trace event
+  struct Event
+  {
+    std::string _name;
+    std::string _category;
+    std::string _args;
+
+    /// The Chrome trace phase: 'B'egin, 'E'nd or 'X' (complete)
+    char _phase;
+
+    /// Start time in seconds since the log was enabled
+    Real _time;
+
+    /// Duration in seconds ('X' events only)
+    Real _duration;
+  };
+
+  /**
+   * Adds an event to the buffer of a thread, writing the buffer out if it is full
+   */
+  void record(const Event & event, THREAD_ID tid);
+
+  /**
+   * Appends the buffered events of a thread to the file and empties the buffer
+   */
+  void flush(THREAD_ID tid);
+
+  /**
+   * Appends one event, or several separated by commas, to the file.  The caller must hold
+   * _file_mutex.
+   */
+  void writeEvent(const std::string & json);
+
+  /// Whether events are being recorded
+  bool _enabled;
+
+  /// The wall time the timestamps are relative to
+  Real _start_time;
+
+  /// The global rank of this processor, used as the trace process id
+  processor_id_type _rank;
+
+  /// Number of events a thread buffers before they are written
+  unsigned int _buffer_size;
+
+  /// The events of each thread that have not been written yet
+  std::vector<std::vector<Event> > _buffers;
+
+  /// The output file of this processor
+  std::ofstream _file;
+
+  /// Whether an event has been written to the file yet (for the separating commas)
+  bool _first_event;
+
+  /// Serializes the writing of full buffers from different threads.  This is a blocking
+  /// mutex rather than a spin mutex since it is held during file I/O.
+  Threads::recursive_mutex _file_mutex;
+};
+
+/**
+ * Records a span from its construction to its destruction, if the log is enabled:
+ *
+ *   {
+ *     TraceScope trace(Moose::trace_log, "solve", "Execution");
+ *     ...
+ *   }
+ */
+class TraceScope
+{
+public:
+  TraceScope(TraceLog & log, const std::string & name, const std::string & category, THREAD_ID tid = 0) :
+      _log(log),
+      _name(name),
+      _category(category),
+      _tid(tid),
+      _active(log.enabled())
+  {
+    if (_active)
+      _log.begin(_name, _category, _tid);
+  }
+
+  ~TraceScope()
+  {
+    if (_active)
+      _log.end(_name, _category, _tid);
+  }
+
+protected:
+  TraceLog & _log;
+  std::string _name;
+  std::string _category;
+  THREAD_ID _tid;
+
+  /// Whether the log was enabled when the span began
+  bool _active;
+};
+
+namespace Moose
+{
+
+/**
+ * Moose::perf_log.push() that also begins a span in Moose::trace_log
+ */
+void perfLogPush(const std::string & event, const std::string & header);
+
+/**
+ * Moose::perf_log.pop() that also ends the span begun by perfLogPush()
+ */
+void perfLogPop(const std::string & event, const std::string & header);
+
+}
+
+#endif // TRACELOG_H
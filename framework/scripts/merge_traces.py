@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+
+# Merges the per-processor files written by the Trace output (<file_base>.trace.<rank>.json)
+# into a single Chrome trace that can be opened in chrome://tracing or https://ui.perfetto.dev
+#
+#   ./merge_traces.py -o out.trace.json out.trace.*.json
+#
+# The files are read one at a time, so only one processor's events are held in memory.
+# A file that was cut short (e.g. by a crashed or killed job) is read up to its last
+# complete event, unless --strict is given, in which case every file must be valid JSON.
+
+import sys, json
+from optparse import OptionParser
+
+def rejectConstant(name):
+  raise ValueError(name + ' is not valid JSON')
+
+def readEvents(file_name, strict):
+  f = open(file_name)
+  text = f.read()
+  f.close()
+
+  try:
+    # Python accepts NaN and Infinity, which other JSON readers do not
+    return json.loads(text, parse_constant=rejectConstant)['traceEvents']
+  except ValueError as e:
+    if strict:
+      sys.stderr.write('ERROR: Unable to read trace file ' + file_name + ': ' + str(e) + '\n')
+      sys.exit(1)
+
+  # Truncated file that ends after a complete event
+  try:
+    return json.loads(text.rstrip() + ']}')['traceEvents']
+  except ValueError:
+    pass
+
+  # Truncated file: drop the partial last event and close the list
+  end = text.rfind('},')
+  if end == -1:
+    end = text.rfind('}')
+    if end == -1:
+      return []
+  try:
+    return json.loads(text[:end+1] + ']}')['traceEvents']
+  except ValueError:
+    sys.stderr.write('Skipping unreadable trace file ' + file_name + '\n')
+    return []
+
+def main():
+  parser = OptionParser(usage='Usage: %prog [options] <trace files>')
+  parser.add_option('-o', '--output', dest='output', default='merged.trace.json', help='The merged trace file (default: merged.trace.json)')
+  parser.add_option('--strict', action='store_true', dest='strict', default=False, help='Fail on files that are not valid JSON instead of reading them up to their last complete event')
+  (options, args) = parser.parse_args()
+
+  if len(args) == 0:
+    parser.print_help()
+    sys.exit(1)
+
+  out = open(options.output, 'w')
+  out.write('{"traceEvents":[\n')
+
+  first = True
+  num_events = 0
+  for file_name in args:
+    for event in readEvents(file_name, options.strict):
+      if not first:
+        out.write(',\n')
+      out.write(json.dumps(event, separators=(',', ':')))
+      first = False
+      num_events += 1
+
+  out.write('\n]}\n')
+  out.close()
+
+  print('Wrote ' + str(num_events) + ' events from ' + str(len(args)) + ' files to ' + options.output)
+
+if __name__ == '__main__':
+  main()
@@ -32,6 +32,7 @@ public:
   virtual void timestepSetup();
 
   virtual void addPoints();
+  virtual void copyPointsFrom(DiracKernel & other);
   void computeContactForce(PenetrationInfo * pinfo);
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
@@ -19,6 +19,7 @@ public:
   SlaveConstraint(const std::string & name, InputParameters parameters);
 
   virtual void addPoints();
+  virtual void copyPointsFrom(DiracKernel & other);
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
@@ -0,0 +1,54 @@
+/****************************************************************/
+/*             DO NOT MODIFY OR REMOVE THIS HEADER              */
+/*          FALCON - Fracturing And Liquid CONvection           */
+/*                                                              */
+/*       (c) pending 2012 Battelle Energy Alliance, LLC         */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef WATERSTEAMPROPERTYAUX_H
+#define WATERSTEAMPROPERTYAUX_H
+
+#include "AuxKernel.h"
+
+//Forward Declarations
+class WaterSteamPropertyAux;
+class WaterSteamEOS;
+
+template<>
+InputParameters validParams<WaterSteamPropertyAux>();
+
+/**
+ * Evaluates a property of water and steam at the coupled pressure and enthalpy
+ * with a WaterSteamEOS.  The d_* properties are the derivatives returned by
+ * waterAndSteamEquationOfStatePropertiesWithDerivativesPH.
+ */
+class WaterSteamPropertyAux : public AuxKernel
+{
+public:
+  WaterSteamPropertyAux(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual Real computeValue();
+
+  /// The equation of state
+  const WaterSteamEOS & _water_steam_properties;
+
+  /// The property to evaluate
+  const MooseEnum _property;
+
+  VariableValue & _pressure;
+  VariableValue & _enthalpy;
+
+  /// Whether the property is a derivative
+  const bool _derivative;
+};
+
+#endif //WATERSTEAMPROPERTYAUX_H
@@ -49,6 +49,90 @@ public:
     Real waterAndSteamEquationOfStatePropertiesPH (Real enth_in, Real press_in, Real temp_in, Real& phase, Real& temp_out, Real& temp_sat, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& del_press, Real& del_enth) const;
 
     Real waterAndSteamEquationOfStatePropertiesWithDerivativesPH (Real enth_in, Real press_in, Real temp_in, Real& temp_out, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& d_enth_water_d_press, Real& d_enth_steam_d_press, Real& d_dens_d_press, Real& d_temp_d_press, Real& d_enth_water_d_enth, Real& d_enth_steam_d_enth, Real& d_dens_d_enth, Real& d_temp_d_enth, Real& d_sat_fraction_d_enth) const;
+
+protected:
+    /// Number of tabulated properties (temperature, density and viscosity)
+    static const unsigned int _n_table_props = 3;
+
+    /**
+     * Temperature, density and viscosity of a single phase tabulated on a uniform
+     * (pressure, enthalpy) grid.  Entry [node * _n_table_props + prop] holds property
+     * prop at node = i_press * _table_num_enth + i_enth.
+     */
+    struct PropertyTable
+    {
+      /// Whether the node lies in the phase of this table and the direct solve converged there
+      std::vector<char> _valid;
+      /// Nodal values
+      std::vector<Real> _value;
+      /// Nodal derivatives w.r.t. pressure and enthalpy
+      std::vector<Real> _d_dpress;
+      std::vector<Real> _d_denth;
+    };
+
+    /// Fills both tables and checks them against the direct IAPWS path
+    void buildTables();
+
+    /**
+     * Fills the table of phase 1 (compressed water) or phase 2 (superheated steam)
+     * using the direct IAPWS path at every node.
+     */
+    void buildTable(PropertyTable & table, int phase);
+
+    /**
+     * Computes the nodal derivatives from the nodal values.  The slopes are the harmonic
+     * mean of the neighboring secants (zero at local extrema), so that the interpolant
+     * stays monotone wherever the data is monotone.
+     */
+    void computeTableSlopes(PropertyTable & table);
+
+    /**
+     * Interpolates the properties from the table with bicubic Hermite polynomials.
+     * Returns false if (press, enth) is outside the table or the cell touches a node
+     * of another phase, in which case the direct IAPWS path has to be used.
+     * @param value temperature, density and viscosity
+     * @param d_dpress derivatives of value w.r.t. pressure (may be NULL)
+     * @param d_denth derivatives of value w.r.t. enthalpy (may be NULL)
+     */
+    bool tableLookup(const PropertyTable & table, Real press, Real enth, Real * value, Real * d_dpress, Real * d_denth) const;
+
+    /// Largest relative deviation of the table from the direct IAPWS path at the cell centers
+    Real tableError(const PropertyTable & table, int phase) const;
+
+    /// Reads the tables from _table_file, returns false if it does not match the table parameters
+    bool readTables();
+
+    /// Writes the tables to _table_file, through a temporary file that is renamed when complete
+    void writeTables() const;
+
+    /// Whether the single phase properties are interpolated from tables
+    const bool _use_table;
+
+    ///@{ Table grid
+    Real _table_press_min;
+    Real _table_press_max;
+    Real _table_enth_min;
+    Real _table_enth_max;
+    unsigned int _table_num_press;
+    unsigned int _table_num_enth;
+    Real _table_dpress;
+    Real _table_denth;
+    ///@}
+
+    /// Binary cache of the tables
+    const std::string _table_file;
+
+    /// Accuracy target of the tables
+    const Real _table_tolerance;
+
+    /// Accuracy of the tables, as checked against the direct IAPWS path
+    Real _table_error;
+
+    /// Compressed water table
+    PropertyTable _water_table;
+
+    /// Superheated steam table
+    PropertyTable _steam_table;
 };
 
 #endif /* WATERSTEAMEOS_H */
@@ -0,0 +1,304 @@
+# Compares the properties interpolated from coarse WaterSteamEOS tables with the
+# direct IAPWS path.  The mesh spans a (pressure, enthalpy) range that covers
+# compressed water, two phase mixtures and superheated steam.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 14
+  ny = 33
+  xmin = 1e6
+  xmax = 15e6
+  ymin = 1e5
+  ymax = 3.4e6
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./enthalpy]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./temperature_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./temperature_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./temperature_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./density_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./density_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./density_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./water_viscosity_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./water_viscosity_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./water_viscosity_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./steam_viscosity_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./steam_viscosity_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./steam_viscosity_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./pressure]
+    type = ParsedFunction
+    value = x
+  [../]
+  [./enthalpy]
+    type = ParsedFunction
+    value = y
+  [../]
+[]
+
+[UserObjects]
+  [./eos_direct]
+    type = WaterSteamEOS
+  [../]
+  [./eos_table]
+    type = WaterSteamEOS
+    use_table = true
+    table_num_pressure = 50
+    table_num_enthalpy = 100
+    table_tolerance = 5e-3
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure]
+    type = FunctionAux
+    variable = pressure
+    function = pressure
+    execute_on = 'initial timestep_end'
+  [../]
+  [./enthalpy]
+    type = FunctionAux
+    variable = enthalpy
+    function = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./temperature_direct]
+    type = WaterSteamPropertyAux
+    variable = temperature_direct
+    water_steam_properties = eos_direct
+    property = temperature
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./temperature_table]
+    type = WaterSteamPropertyAux
+    variable = temperature_table
+    water_steam_properties = eos_table
+    property = temperature
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./temperature_ratio]
+    type = QuotientAux
+    variable = temperature_ratio
+    numerator = temperature_table
+    denominator = temperature_direct
+    execute_on = 'initial timestep_end'
+  [../]
+  [./density_direct]
+    type = WaterSteamPropertyAux
+    variable = density_direct
+    water_steam_properties = eos_direct
+    property = density
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./density_table]
+    type = WaterSteamPropertyAux
+    variable = density_table
+    water_steam_properties = eos_table
+    property = density
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./density_ratio]
+    type = QuotientAux
+    variable = density_ratio
+    numerator = density_table
+    denominator = density_direct
+    execute_on = 'initial timestep_end'
+  [../]
+  [./water_viscosity_direct]
+    type = WaterSteamPropertyAux
+    variable = water_viscosity_direct
+    water_steam_properties = eos_direct
+    property = water_viscosity
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./water_viscosity_table]
+    type = WaterSteamPropertyAux
+    variable = water_viscosity_table
+    water_steam_properties = eos_table
+    property = water_viscosity
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./water_viscosity_ratio]
+    type = QuotientAux
+    variable = water_viscosity_ratio
+    numerator = water_viscosity_table
+    denominator = water_viscosity_direct
+    execute_on = 'initial timestep_end'
+  [../]
+  [./steam_viscosity_direct]
+    type = WaterSteamPropertyAux
+    variable = steam_viscosity_direct
+    water_steam_properties = eos_direct
+    property = steam_viscosity
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./steam_viscosity_table]
+    type = WaterSteamPropertyAux
+    variable = steam_viscosity_table
+    water_steam_properties = eos_table
+    property = steam_viscosity
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./steam_viscosity_ratio]
+    type = QuotientAux
+    variable = steam_viscosity_ratio
+    numerator = steam_viscosity_table
+    denominator = steam_viscosity_direct
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./max_temperature_ratio]
+    type = ElementExtremeValue
+    variable = temperature_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_temperature_ratio]
+    type = ElementExtremeValue
+    variable = temperature_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_density_ratio]
+    type = ElementExtremeValue
+    variable = density_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_density_ratio]
+    type = ElementExtremeValue
+    variable = density_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_water_viscosity_ratio]
+    type = ElementExtremeValue
+    variable = water_viscosity_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_water_viscosity_ratio]
+    type = ElementExtremeValue
+    variable = water_viscosity_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_steam_viscosity_ratio]
+    type = ElementExtremeValue
+    variable = steam_viscosity_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_steam_viscosity_ratio]
+    type = ElementExtremeValue
+    variable = steam_viscosity_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  csv = true
+  output_on = 'initial timestep_end'
+  [./console]
+    type = Console
+    perf_log = true
+    output_on = 'timestep_end failed nonlinear'
+  [../]
+[]
@@ -0,0 +1,256 @@
+# Compares the derivatives of the interpolated WaterSteamEOS tables with the
+# derivatives of the direct IAPWS path.  The table derivatives are only used in
+# single phase cells, so the mesh spans compressed water (and superheated steam
+# through cli_args in the tests file).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 14
+  ny = 12
+  xmin = 1e6
+  xmax = 15e6
+  ymin = 1e5
+  ymax = 7e5
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./enthalpy]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_temperature_d_enthalpy_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_temperature_d_enthalpy_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_temperature_d_enthalpy_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_pressure_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_pressure_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_pressure_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_enthalpy_direct]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_enthalpy_table]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./d_density_d_enthalpy_ratio]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./pressure]
+    type = ParsedFunction
+    value = x
+  [../]
+  [./enthalpy]
+    type = ParsedFunction
+    value = y
+  [../]
+[]
+
+[UserObjects]
+  [./eos_direct]
+    type = WaterSteamEOS
+  [../]
+  [./eos_table]
+    type = WaterSteamEOS
+    use_table = true
+    table_num_pressure = 50
+    table_num_enthalpy = 100
+    table_tolerance = 5e-3
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure]
+    type = FunctionAux
+    variable = pressure
+    function = pressure
+    execute_on = 'initial timestep_end'
+  [../]
+  [./enthalpy]
+    type = FunctionAux
+    variable = enthalpy
+    function = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_temperature_d_enthalpy_direct]
+    type = WaterSteamPropertyAux
+    variable = d_temperature_d_enthalpy_direct
+    water_steam_properties = eos_direct
+    property = d_temperature_d_enthalpy
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_temperature_d_enthalpy_table]
+    type = WaterSteamPropertyAux
+    variable = d_temperature_d_enthalpy_table
+    water_steam_properties = eos_table
+    property = d_temperature_d_enthalpy
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_temperature_d_enthalpy_ratio]
+    type = QuotientAux
+    variable = d_temperature_d_enthalpy_ratio
+    numerator = d_temperature_d_enthalpy_table
+    denominator = d_temperature_d_enthalpy_direct
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_pressure_direct]
+    type = WaterSteamPropertyAux
+    variable = d_density_d_pressure_direct
+    water_steam_properties = eos_direct
+    property = d_density_d_pressure
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_pressure_table]
+    type = WaterSteamPropertyAux
+    variable = d_density_d_pressure_table
+    water_steam_properties = eos_table
+    property = d_density_d_pressure
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_pressure_ratio]
+    type = QuotientAux
+    variable = d_density_d_pressure_ratio
+    numerator = d_density_d_pressure_table
+    denominator = d_density_d_pressure_direct
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_enthalpy_direct]
+    type = WaterSteamPropertyAux
+    variable = d_density_d_enthalpy_direct
+    water_steam_properties = eos_direct
+    property = d_density_d_enthalpy
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_enthalpy_table]
+    type = WaterSteamPropertyAux
+    variable = d_density_d_enthalpy_table
+    water_steam_properties = eos_table
+    property = d_density_d_enthalpy
+    pressure = pressure
+    enthalpy = enthalpy
+    execute_on = 'initial timestep_end'
+  [../]
+  [./d_density_d_enthalpy_ratio]
+    type = QuotientAux
+    variable = d_density_d_enthalpy_ratio
+    numerator = d_density_d_enthalpy_table
+    denominator = d_density_d_enthalpy_direct
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./max_d_temperature_d_enthalpy_ratio]
+    type = ElementExtremeValue
+    variable = d_temperature_d_enthalpy_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_d_temperature_d_enthalpy_ratio]
+    type = ElementExtremeValue
+    variable = d_temperature_d_enthalpy_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_d_density_d_pressure_ratio]
+    type = ElementExtremeValue
+    variable = d_density_d_pressure_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_d_density_d_pressure_ratio]
+    type = ElementExtremeValue
+    variable = d_density_d_pressure_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_d_density_d_enthalpy_ratio]
+    type = ElementExtremeValue
+    variable = d_density_d_enthalpy_ratio
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./min_d_density_d_enthalpy_ratio]
+    type = ElementExtremeValue
+    variable = d_density_d_enthalpy_ratio
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  csv = true
+  output_on = 'initial timestep_end'
+  [./console]
+    type = Console
+    perf_log = true
+    output_on = 'timestep_end failed nonlinear'
+  [../]
+[]
@@ -17,6 +17,7 @@ public:
   GapHeatPointSourceMaster(const std::string & name, InputParameters parameters);
 
   virtual void addPoints();
+  virtual void copyPointsFrom(DiracKernel & other);
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 protected:
@@ -4,6 +4,8 @@
 #include "Material.h"
 #include "DerivativeMaterialInterface.h"
 
+#include <algorithm>
+
 // Forward Declarations
 class DerivativeBaseMaterial;
 
@@ -86,6 +88,19 @@ protected:
    */
   virtual Real computeD3F(unsigned int, unsigned int, unsigned int);
 
+  /**
+   * Derivatives are symmetric in their arguments, so only one entry per unique combination
+   * of arguments is stored. These return the position of the second (third) derivative
+   * with respect to the given arguments (in any order) in the compressed derivative vectors.
+   */
+  static unsigned int d2Index(unsigned int i, unsigned int j);
+  static unsigned int d3Index(unsigned int i, unsigned int j, unsigned int k);
+
+  ///@{ Symmetric lookup of the second and third derivative material properties (NULL if not computed)
+  MaterialProperty<Real> * propD2F(unsigned int i, unsigned int j) const { return _prop_d2F[d2Index(i, j)]; }
+  MaterialProperty<Real> * propD3F(unsigned int i, unsigned int j, unsigned int k) const { return _prop_d3F[d3Index(i, j, k)]; }
+  ///@}
+
   /// Coupled variables for function arguments
   std::vector<VariableValue *> _args;
 
@@ -113,11 +128,34 @@ protected:
   /// Material properties to store the derivatives of f with respect to arg[i]
   std::vector<MaterialProperty<Real> *> _prop_dF;
 
-  /// Material properties to store the second derivatives.
-  std::vector<std::vector<MaterialProperty<Real> *> > _prop_d2F;
+  /// Material properties to store the unique second derivatives (indexed by d2Index()).
+  std::vector<MaterialProperty<Real> *> _prop_d2F;
 
-  /// Material properties to store the third derivatives.
-  std::vector<std::vector<std::vector<MaterialProperty<Real> *> > > _prop_d3F;
+  /// Material properties to store the unique third derivatives (indexed by d3Index()).
+  std::vector<MaterialProperty<Real> *> _prop_d3F;
 };
 
+inline unsigned int
+DerivativeBaseMaterial::d2Index(unsigned int i, unsigned int j)
+{
+  if (i > j)
+    std::swap(i, j);
+
+  return j * (j + 1) / 2 + i;
+}
+
+inline unsigned int
+DerivativeBaseMaterial::d3Index(unsigned int i, unsigned int j, unsigned int k)
+{
+  // sort the arguments so that i <= j <= k
+  if (i > j)
+    std::swap(i, j);
+  if (j > k)
+    std::swap(j, k);
+  if (i > j)
+    std::swap(i, j);
+
+  return k * (k + 1) * (k + 2) / 6 + j * (j + 1) / 2 + i;
+}
+
 #endif //DERIVATIVEBASEMATERIAL_H
@@ -3,6 +3,7 @@
 
 #include "DerivativeBaseMaterial.h"
 #include "libmesh/fparser_ad.hh"
+#include "libmesh/threads.h"
 
 // Forward Declarations
 class DerivativeParsedMaterialHelper;
@@ -32,17 +33,66 @@ public:
                      const std::vector<std::string> & tol_names,
                      const std::vector<Real> & tol_values);
 
+  virtual void initialSetup();
+
 protected:
   virtual void computeProperties();
 
+  /**
+   * Evaluate every function into its property for all quadrature points of the current element at
+   * once, one function at a time (used when batch_evaluation is enabled).
+   */
+  void computePropertiesBatch();
+
   void functionsDerivative();
   void functionsOptimize();
 
+  /**
+   * Take the derivatives from the function cache entry for key, or take and optimize
+   * them now and store them in the cache if no identical function was parsed before.
+   */
+  void functionsCached(const std::string & key);
+
   /// Shorthand for an autodiff function parser object.
   typedef FunctionParserADBase<Real> ADFunction;
 
+  /// Copy a function parser object that does not share any data with the original (NULL for vanishing derivatives is passed on)
+  static ADFunction * copyFunction(ADFunction * function);
+
+  /// Optimize and JIT compile a function parser object, vanishing functions are deleted and set to NULL
+  void optimizeFunction(ADFunction * & function);
+
+  /// Delete a function parser object that is no longer needed and set it to NULL
+  static void releaseFunction(ADFunction * & function);
+
+  /// Append a function and the property it is evaluated into to _batch_functions
+  void addBatchFunction(ADFunction * function, MaterialProperty<Real> * property);
+
+  /**
+   * The optimized (and possibly JIT compiled) function parser objects of a function and its derivatives.
+   * These are shared by all materials in the process that parse the same function with the same
+   * settings, i.e. the per-thread copies of a material and identical materials in sub-apps.
+   */
+  class FunctionCache
+  {
+  public:
+    ~FunctionCache();
+
+    ADFunction * _F;
+    std::vector<ADFunction *> _dF;
+    std::vector<ADFunction *> _d2F;
+    std::vector<ADFunction *> _d3F;
+  };
+
+  /// Cached functions keyed on the expression, its arguments, constants and the derivative and optimization settings
+  static std::map<std::string, MooseSharedPointer<FunctionCache> > _function_cache;
+
+  /// Guards _function_cache and the copying of its entries (FParser copies share reference counted data)
+  static Threads::spin_mutex _function_cache_mutex;
+
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunction *);
+  Real evaluate(ADFunction *, const Real * params);
 
   /// The undiffed free energy function parser object.
   ADFunction * _func_F;
@@ -50,11 +100,11 @@ protected:
   /// The first derivatives of the free energy (function parser objects).
   std::vector<ADFunction *> _func_dF;
 
-  /// The second derivatives of the free energy (function parser objects).
-  std::vector<std::vector<ADFunction *> > _func_d2F;
+  /// The unique second derivatives of the free energy (function parser objects, indexed by d2Index()).
+  std::vector<ADFunction *> _func_d2F;
 
-  /// The third derivatives of the free energy (function parser objects).
-  std::vector<std::vector<std::vector<ADFunction *> > > _func_d3F;
+  /// The unique third derivatives of the free energy (function parser objects, indexed by d3Index()).
+  std::vector<ADFunction *> _func_d3F;
 
   /// Material properties needed by this free energy
   std::vector<MaterialProperty<Real> *> _mat_props;
@@ -66,10 +116,25 @@ protected:
   /// Tolerance values for all arguments (to protect from log(0)).
   std::vector<Real> _tol;
 
+  /// A function parser object together with the material property it is evaluated into
+  struct BatchFunction
+  {
+    ADFunction * _function;
+    MaterialProperty<Real> * _property;
+  };
+
+  /// The functions of all properties requested by the simulation (only built in batch evaluation mode)
+  std::vector<BatchFunction> _batch_functions;
+
+  /// Staged function parameters of all quadrature points of an element (one row of _nargs + _nmat_props values per qp)
+  std::vector<Real> _batch_params;
+
   /// feature flags
   bool _enable_jit;
   bool _disable_fpoptimizer;
   bool _fail_on_evalerror;
+  bool _cache_functions;
+  bool _batch_evaluation;
 
   /// appropriate not a number value to return
   const Real _nan;
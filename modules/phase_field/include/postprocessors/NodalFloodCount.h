@@ -18,6 +18,7 @@
 #include "GeneralPostprocessor.h"
 #include "Coupleable.h"
 #include "MooseVariableDependencyInterface.h"
+#include "MeshChangedInterface.h"
 #include "ZeroInterface.h"
 #include "InfixIterator.h"
 
@@ -32,6 +33,7 @@
 class NodalFloodCount;
 class MooseMesh;
 class MooseVariable;
+class FloodVariablesThread;
 
 template<>
 InputParameters validParams<NodalFloodCount>();
@@ -48,6 +50,7 @@ class NodalFloodCount :
   public GeneralPostprocessor,
   public Coupleable,
   public MooseVariableDependencyInterface,
+  public MeshChangedInterface,
   public ZeroInterface
 {
 public:
@@ -60,6 +63,12 @@ public:
   virtual void finalize();
   virtual Real getValue();
 
+  /**
+   * The node adjacency used for flooding is cached between executions, it is rebuilt
+   * the next time this object is initialized after the mesh changes.
+   */
+  virtual void meshChanged();
+
   // Retrieve field information
   virtual Real getNodalValue(dof_id_type node_id, unsigned int var_idx=0, bool show_var_coloring=false) const;
   virtual Real getElementalValue(dof_id_type element_id) const;
@@ -91,16 +100,43 @@ protected:
 
   /**
    * This method will "mark" all nodes on neighboring elements that
-   * are above the supplied threshold
+   * are above the supplied threshold.  The nodes are given by their
+   * compact index (see _compact_nodes) and the region is grown with an explicit
+   * stack so that large bubbles cannot overflow the call stack.
+   */
+  void flood(unsigned int start_node, unsigned int current_idx, std::vector<std::pair<unsigned int, unsigned int> > & stack);
+
+  /**
+   * Marks a single node for the given variable if it has not been visited before and its value
+   * passes the threshold.  A zero live_region starts a new region.  Returns true when the node
+   * was added to a region so that its neighbors should be flooded as well.
    */
-  void flood(const Node *node, int current_idx, unsigned int live_region);
+  bool visitNode(unsigned int node, unsigned int current_idx, unsigned int live_region);
+
+  /**
+   * Floods every region of a single variable.  Only used in multi-map mode where the variables
+   * are independent of one another, which allows them to be flooded on separate threads.
+   */
+  void floodVariable(unsigned int current_idx);
+
+  /**
+   * Builds the compact node numbering, the node adjacency graph and the flood starting nodes
+   * used by execute().  This is only done when the mesh changes.
+   */
+  void buildNodeAdjacency();
 
   /**
    * These routines packs/unpack the _bubble_map data into a structure suitable for parallel
    * communication operations. See the comments in these routines for the exact
    * data structure layout.
    */
-  void pack(std::vector<unsigned int> &, bool merge_periodic_info=true) const;
+  void pack(std::vector<unsigned int> &, bool merge_periodic_info=true);
+
+  /**
+   * Replaces the representative nodes of the regions that were packed without their
+   * neighbors (see pack()) with the full set of nodes kept on this processor.
+   */
+  void restoreInteriorRegions();
   void unpack(const std::vector<unsigned int> &);
 
   /**
@@ -208,11 +244,45 @@ protected:
   const unsigned int _maps_size;
 
   /**
-   * This variable keeps track of which nodes have been visited during execution.  We don't use the _bubble_map
-   * for this since we don't want to explicitly store data for all the unmarked nodes in a serialized datastructures.
-   * This keeps our overhead down since this variable never needs to be communicated.
+   * This variable keeps track of which nodes have been visited during execution (indexed by compact node
+   * index).  We don't use the _bubble_map for this since we don't want to explicitly store data for all
+   * the unmarked nodes in a serialized datastructures.  This variable never needs to be communicated.
    */
-  std::vector<std::map<dof_id_type, bool> > _nodes_visited;
+  std::vector<std::vector<bool> > _nodes_visited;
+
+  /// The value of each coupled variable at the compact nodes, gathered once per execution
+  std::vector<std::vector<Number> > _nodal_values;
+
+  /// Whether the cached node adjacency data below is valid for the current mesh
+  bool _adjacency_built;
+
+  /// The semi-local nodes, the position of a node in this vector is its compact index
+  std::vector<const Node *> _compact_nodes;
+
+  /// The compact index of every node indexed by node id (invalid_uint for nodes that are not semi-local)
+  std::vector<unsigned int> _node_to_compact;
+
+  /**
+   * The node adjacency graph in compressed row form: the (semi-local) neighbors of compact node i
+   * are _adjacency[_adjacency_offsets[i]] through _adjacency[_adjacency_offsets[i+1] - 1].
+   */
+  std::vector<unsigned int> _adjacency_offsets;
+  std::vector<unsigned int> _adjacency;
+
+  /// The compact indices of the vertices of the active local elements in the order flooding starts from them
+  std::vector<unsigned int> _flood_start_nodes;
+
+  /**
+   * Nodes that are only touched by elements owned by this processor (indexed by compact node index).
+   * A region made entirely of these nodes cannot be shared with another processor.
+   */
+  std::vector<bool> _interior_nodes;
+
+  /**
+   * Regions made entirely of interior nodes are communicated as a single representative node, the
+   * full node sets are kept here keyed by the owning variable index and the representative node.
+   */
+  std::map<std::pair<unsigned int, dof_id_type>, std::set<dof_id_type> > _interior_regions;
 
   /**
    * The bubble maps contain the raw flooded node information and eventually the unique grain numbers.  We have a vector
@@ -293,6 +363,8 @@ protected:
    * false.
    */
   bool _compute_boundary_intersecting_volume;
+
+  friend class FloodVariablesThread;
 };
 
 template<typename T>
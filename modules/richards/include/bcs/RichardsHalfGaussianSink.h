@@ -8,6 +8,7 @@
 
 #include "IntegratedBC.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 
 // Forward Declarations
 class RichardsHalfGaussianSink;
@@ -66,7 +67,7 @@ protected:
   MaterialProperty<std::vector<Real> > & _pp;
 
   /// d(porepressure_i)/dvariable_j
-  MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dpp_dv;
 };
 
 #endif //RICHARDSHALFGAUSSIANSINK
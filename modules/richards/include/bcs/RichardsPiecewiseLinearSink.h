@@ -10,6 +10,7 @@
 #include "LinearInterpolation.h"
 #include "Function.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
@@ -97,7 +98,7 @@ protected:
    * d(_nodal_density)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dnodal_density_dv;
+  RichardsPhaseArray<Real> _dnodal_density_dv;
 
   /**
    * nodal values of relative permeability
@@ -109,13 +110,13 @@ protected:
    * d(_nodal_relperm)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dnodal_relperm_dv;
+  RichardsPhaseArray<Real> _dnodal_relperm_dv;
 
   /// porepressure values (only the _pvar component is used)
   MaterialProperty<std::vector<Real> > & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dpp_dv;
 
   /// viscosity (only the _pvar component is used)
   MaterialProperty<std::vector<Real> > & _viscosity;
@@ -127,19 +128,19 @@ protected:
    * derivative of effective saturation wrt variables
    * only _dseff_dv[_pvar][i] is used for i being all variables
    */
-  MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dseff_dv;
 
   /// relative permeability (only the _pvar component is used)
   MaterialProperty<std::vector<Real> > & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _drel_perm_dv;
 
   /// fluid density (only the _pvar component is used)
   MaterialProperty<std::vector<Real> > & _density;
 
   /// d(density_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _ddensity_dv;
 
   /**
    * Holds the values of pressures at all the nodes of the element
@@ -11,6 +11,7 @@
 #include "Function.h"
 #include "RichardsSumQuantity.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
@@ -116,7 +117,7 @@ protected:
    * d(_mobility)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dmobility_dv;
+  RichardsPhaseArray<Real> _dmobility_dv;
 
 
 
@@ -149,7 +150,7 @@ protected:
   MaterialProperty<std::vector<Real> > & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dpp_dv;
 
   /// fluid viscosity
   MaterialProperty<std::vector<Real> > & _viscosity;
@@ -158,19 +159,19 @@ protected:
   MaterialProperty<RealTensorValue> & _permeability;
 
   /// deriviatves of Seff wrt variables
-  MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dseff_dv;
 
   /// relative permeability
   MaterialProperty<std::vector<Real> > & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _drel_perm_dv;
 
   /// fluid density
   MaterialProperty<std::vector<Real> > & _density;
 
   /// d(density_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _ddensity_dv;
 
   /**
    * This is used to hold the total fluid flowing into the borehole
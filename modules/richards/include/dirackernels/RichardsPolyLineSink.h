@@ -10,6 +10,7 @@
 #include "LinearInterpolation.h"
 #include "RichardsSumQuantity.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 
 //Forward Declarations
 class RichardsPolyLineSink;
@@ -65,7 +66,7 @@ protected:
   MaterialProperty<std::vector<Real> > &_pp;
 
   /// d(porepressure_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > &_dpp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > &_dpp_dv;
 
   /// vector of Dirac Points' x positions
   std::vector<Real> _xs;
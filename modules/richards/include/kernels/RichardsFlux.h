@@ -8,6 +8,7 @@
 
 #include "Kernel.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 
 // Forward Declarations
 class RichardsFlux;
@@ -53,19 +54,19 @@ protected:
   MaterialProperty<std::vector<RealVectorValue> > &_flux;
 
   /// d(Richards flux_i)/d(variable_j), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > &_dflux_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > &_dflux_dv;
 
   /// d(Richards flux_i)/d(grad(variable_j)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > &_dflux_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > &_dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > &_d2flux_dvdv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > &_d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dgradvdv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > &_d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dvdgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > &_d2flux_dvdgradv;
 
 
 
@@ -79,10 +80,10 @@ protected:
   MaterialProperty<std::vector<RealVectorValue> >&_tauvel_SUPG;
 
   /// derivative of SUPGtau*SUPGvel_i wrt grad(variable_j)
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > >&_dtauvel_SUPG_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> >&_dtauvel_SUPG_dgradv;
 
   /// derivative of SUPGtau*SUPGvel_i wrt variable_j
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > >&_dtauvel_SUPG_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> >&_dtauvel_SUPG_dv;
 
   /**
    * Computes diagonal and off-diagonal jacobian entries.
@@ -8,6 +8,7 @@
 
 #include "Kernel.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
@@ -121,10 +122,10 @@ protected:
   MaterialProperty<std::vector<RealVectorValue> > & _flux_no_mob;
 
   /// d(_flux_no_mob)/d(variable)
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_no_mob_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _dflux_no_mob_dv;
 
   /// d(_flux_no_mob)/d(grad(variable))
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_no_mob_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _dflux_no_mob_dgradv;
 
   /// number of nodes in this element
   unsigned int _num_nodes;
@@ -139,7 +140,7 @@ protected:
    * d(_mobility)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations
    */
-  std::vector<std::vector<Real> > _dmobility_dv;
+  RichardsPhaseArray<Real> _dmobility_dv;
 
   /**
    * Holds the values of pressures at all the nodes of the element
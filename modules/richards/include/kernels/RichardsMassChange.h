@@ -8,6 +8,7 @@
 
 #include "TimeDerivative.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseArray.h"
 
 // Forward Declarations
 class RichardsMassChange;
@@ -51,7 +52,7 @@ protected:
   MaterialProperty<std::vector<Real> > & _mass;
 
   /// d(fluid mass_i)/d(var_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dmass;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dmass;
 
   /// old value of fluid mass (or fluid masses in multiphase) at quadpoints
   MaterialProperty<std::vector<Real> > & _mass_old;
@@ -60,10 +61,10 @@ protected:
   MaterialProperty<std::vector<RealVectorValue> > & _tauvel_SUPG;
 
   /// derivative of tau_SUPG wrt grad(variable)
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dtauvel_SUPG_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _dtauvel_SUPG_dgradv;
 
   /// deriv of tau_SUPG wrt variable
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dtauvel_SUPG_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _dtauvel_SUPG_dv;
 
   /**
    * Derivative of residual with respect to wrt_num Richards variable
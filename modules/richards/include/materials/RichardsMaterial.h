@@ -14,6 +14,7 @@
 #include "RichardsSeff.h"
 #include "RichardsSat.h"
 #include "RichardsSUPG.h"
+#include "RichardsPhaseArray.h"
 
 //Forward Declarations
 class RichardsMaterial;
@@ -63,10 +64,10 @@ private:
   MaterialProperty<std::vector<Real> > & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dpp_dv;
 
   /// d^2(porepressure_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2pp_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _d2pp_dv;
 
 
   /// fluid viscosity (or viscosities in the multiphase case)
@@ -80,7 +81,7 @@ private:
   MaterialProperty<std::vector<Real> > & _density;
 
   /// d(density_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _ddensity_dv;
 
 
   /// old effective saturation
@@ -90,10 +91,10 @@ private:
   MaterialProperty<std::vector<Real> > & _seff; // effective saturation
 
   /// d(Seff_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv; // d(seff)/dp
+  MaterialProperty<RichardsPhaseArray<Real> > & _dseff_dv; // d(seff)/dp
 
   /// d^2(Seff_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2seff_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _d2seff_dv;
 
   /// old saturation
   MaterialProperty<std::vector<Real> > & _sat_old;
@@ -102,14 +103,14 @@ private:
   MaterialProperty<std::vector<Real> > & _sat;
 
   /// d(saturation_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dsat_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dsat_dv;
 
 
   /// relative permeability (vector of relative permeabilities in case of multiphase)
   MaterialProperty<std::vector<Real> > & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  MaterialProperty<RichardsPhaseArray<Real> > & _drel_perm_dv;
 
 
   /// old value of fluid mass (a vector of masses for multicomponent)
@@ -119,51 +120,57 @@ private:
   MaterialProperty<std::vector<Real> > & _mass;
 
   /// d(fluid mass_i)/dP_j (a vector of masses for multicomponent)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dmass;
+  MaterialProperty<RichardsPhaseArray<Real> > & _dmass;
 
 
   /// permeability*(grad(P) - density*gravity)  (a vector of these for multicomponent)
   MaterialProperty<std::vector<RealVectorValue> > & _flux_no_mob;
 
   /// d(_flux_no_mob_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_no_mob_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _dflux_no_mob_dv;
 
   /// d(_flux_no_mob_i)/d(grad(variable_j))
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_no_mob_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _dflux_no_mob_dgradv;
 
 
   /// fluid flux (a vector of fluxes for multicomponent)
   MaterialProperty<std::vector<RealVectorValue> > & _flux;
 
   /// d(Richards flux_i)/d(variable_j), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_dv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _dflux_dv;
 
   /// d(Richards flux_i)/d(grad(variable_j)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_dgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > & _d2flux_dvdv;
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dgradvdv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue.  We should have _d2flux_dvdgradv[i][j][k] = _d2flux_dgradvdv[i][k][j], but i think it is more clear having both, and hopefully not a blowout on memory/CPU.
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dvdgradv;
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _d2flux_dvdgradv;
 
 
 
 
   MaterialProperty<std::vector<RealVectorValue> > & _tauvel_SUPG; // tauSUPG * velSUPG
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dtauvel_SUPG_dgradp; // d (_tauvel_SUPG_i)/d(_grad_variable_j)
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dtauvel_SUPG_dp; // d (_tauvel_SUPG_i)/d(variable_j)
+  MaterialProperty<RichardsPhaseArray<RealTensorValue> > & _dtauvel_SUPG_dgradp; // d (_tauvel_SUPG_i)/d(_grad_variable_j)
+  MaterialProperty<RichardsPhaseArray<RealVectorValue> > & _dtauvel_SUPG_dp; // d (_tauvel_SUPG_i)/d(variable_j)
 
   std::vector<VariableValue *> _perm_change;
 
   /// d^2(density)/dp_j/dP_k - used in various derivative calculations
-  std::vector<std::vector<std::vector<Real> > > _d2density;
+  RichardsPhaseArray<Real> _d2density;
 
   /// d^2(relperm_i)/dP_j/dP_k - used in various derivative calculations
-  std::vector<std::vector<std::vector<Real> > > _d2rel_perm_dv;
+  RichardsPhaseArray<Real> _d2rel_perm_dv;
+
+  /// d(Seff_i)/d(variable_j) for one i, as filled by the RichardsSeff UserObjects
+  std::vector<Real> _dseff_scratch;
+
+  /// d^2(Seff_i)/d(variable_j)/d(variable_k) for one i, as filled by the RichardsSeff UserObjects
+  std::vector<std::vector<Real> > _d2seff_scratch;
 
 
 
@@ -38,7 +38,7 @@ public:
    * @param p porepressure in the element.  Note that (*p[0])[qp] is the porepressure at quadpoint qp
    * @param qp the quad point to evaluate effective saturation at
    */
-  Real seff(std::vector<VariableValue *> p, unsigned int qp) const;
+  Real seff(const std::vector<VariableValue *> & p, unsigned int qp) const;
 
   /**
    * derivative of effective saturation as a function of porepressure
@@ -46,7 +46,7 @@ public:
    * @param qp the quad point to evaluate effective saturation at
    * @param result the derivtives will be placed in this array
    */
-  void dseff(std::vector<VariableValue *> p, unsigned int qp, std::vector<Real> & result) const;
+  void dseff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<Real> & result) const;
 
   /**
    * second derivative of effective saturation as a function of porepressure
@@ -54,7 +54,7 @@ public:
    * @param qp the quad point to evaluate effective saturation at
    * @param result the derivtives will be placed in this array
    */
-  void d2seff(std::vector<VariableValue *> p, unsigned int qp, std::vector<std::vector<Real> > & result) const;
+  void d2seff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<std::vector<Real> > & result) const;
 
 protected:
 
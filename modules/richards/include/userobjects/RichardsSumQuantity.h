@@ -31,6 +31,7 @@ public:
 
   /**
    * adds contrib to _total
+   * This is thread safe, as the DiracKernels calling it are threaded
    * @param contrib the amount to add to _total
    */
   void add(Real contrib);
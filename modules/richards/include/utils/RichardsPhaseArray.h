@@ -0,0 +1,131 @@
+/*****************************************/
+/* Written by andrew.wilkins@csiro.au    */
+/* Please contact me if you make changes */
+/*****************************************/
+
+#ifndef RICHARDSPHASEARRAY_H
+#define RICHARDSPHASEARRAY_H
+
+#include "Moose.h"
+#include "DataIO.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Fixed-stride storage for the multiphase quantities of RichardsMaterial,
+ * such as d(porepressure_i)/d(variable_j) or d^2(flux_i)/d(variable_j)/d(variable_k).
+ * The entries (i, j) or (i, j, k) of one quadpoint are held in a single
+ * contiguous block, instead of in nested std::vectors.
+ *
+ * resize() only allocates when the total number of entries grows,
+ * so once a MaterialProperty of these has been sized for the
+ * number of phases no allocation happens in the residual and Jacobian loops.
+ */
+template<typename T>
+class RichardsPhaseArray
+{
+public:
+  RichardsPhaseArray() :
+      _n0(0),
+      _n1(0),
+      _n2(0)
+  {
+  }
+
+  /**
+   * Sets the dimensions of the array.  Entries are not zeroed.
+   * @param n0 number of phases (the i index)
+   * @param n1 number of variables (the j index)
+   * @param n2 number of variables (the k index), 1 for two-index quantities
+   */
+  void resize(unsigned int n0, unsigned int n1, unsigned int n2 = 1)
+  {
+    _n0 = n0;
+    _n1 = n1;
+    _n2 = n2;
+    _values.resize(n0 * n1 * n2);
+  }
+
+  /// Sets all entries to value
+  void assign(const T & value) { std::fill(_values.begin(), _values.end(), value); }
+
+  /// Sets the dimensions and all entries to value
+  void assign(unsigned int n0, unsigned int n1, unsigned int n2, const T & value)
+  {
+    resize(n0, n1, n2);
+    assign(value);
+  }
+
+  /// The number of entries
+  unsigned int size() const { return _values.size(); }
+
+  /// entry (i, j) of a two-index quantity
+  T & operator()(unsigned int i, unsigned int j)
+  {
+    mooseAssert(_n2 == 1 && i < _n0 && j < _n1, "RichardsPhaseArray index out of range");
+    return _values[i * _n1 + j];
+  }
+
+  const T & operator()(unsigned int i, unsigned int j) const
+  {
+    mooseAssert(_n2 == 1 && i < _n0 && j < _n1, "RichardsPhaseArray index out of range");
+    return _values[i * _n1 + j];
+  }
+
+  /// entry (i, j, k) of a three-index quantity
+  T & operator()(unsigned int i, unsigned int j, unsigned int k)
+  {
+    mooseAssert(i < _n0 && j < _n1 && k < _n2, "RichardsPhaseArray index out of range");
+    return _values[(i * _n1 + j) * _n2 + k];
+  }
+
+  const T & operator()(unsigned int i, unsigned int j, unsigned int k) const
+  {
+    mooseAssert(i < _n0 && j < _n1 && k < _n2, "RichardsPhaseArray index out of range");
+    return _values[(i * _n1 + j) * _n2 + k];
+  }
+
+  /// Stores the dimensions and the entries (for restart)
+  void store(std::ostream & stream, void * context)
+  {
+    storeHelper(stream, _n0, context);
+    storeHelper(stream, _n1, context);
+    storeHelper(stream, _n2, context);
+    storeHelper(stream, _values, context);
+  }
+
+  /// Loads the dimensions and the entries (for restart)
+  void load(std::istream & stream, void * context)
+  {
+    loadHelper(stream, _n0, context);
+    loadHelper(stream, _n1, context);
+    loadHelper(stream, _n2, context);
+    loadHelper(stream, _values, context);
+  }
+
+protected:
+  /// the dimensions
+  unsigned int _n0;
+  unsigned int _n1;
+  unsigned int _n2;
+
+  /// the entries, with k running fastest
+  std::vector<T> _values;
+};
+
+template<typename T>
+inline void
+dataStore(std::ostream & stream, RichardsPhaseArray<T> & v, void * context)
+{
+  v.store(stream, context);
+}
+
+template<typename T>
+inline void
+dataLoad(std::istream & stream, RichardsPhaseArray<T> & v, void * context)
+{
+  v.load(stream, context);
+}
+
+#endif // RICHARDSPHASEARRAY_H
@@ -284,6 +284,22 @@ protected:
   RankTwoTensor _pk2_tmp;
   Real _accslip_tmp, _accslip_tmp_old;
   std::vector<Real> _gss_tmp;
+
+  /**
+   * Schmid tensors of all slip systems stored component by component:
+   * entry [(i * LIBMESH_DIM + j) * _nss + a] is component (i,j) of slip system a.
+   * The loops over the slip systems in calcResidual and calcJacobian run over these contiguous arrays.
+   */
+  std::vector<Real> _s0_comp;
+
+  /// Derivative of _fp_inv w.r.t. the slip increments (-_fp_old_inv * _s0), stored like _s0_comp
+  std::vector<Real> _dfpinvdslip_comp;
+
+  /// Work arrays allocated once per material instance
+  std::vector<Real> _s0_dslipdtau_comp;
+  std::vector<Real> _mo_rot, _no_rot;
+  std::vector<Real> _gss_prev;
+  std::vector<Real> _hb;
 };
 
 #endif //FINITESTRAINCRYSTALPLASTICITY_H
@@ -87,14 +87,14 @@ public:
 
 //private:
   /// Gets the value for the index specified.  Takes index = 0,1,2
-  Real & operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l);
+  Real & operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) { return _vals[i][j][k][l]; }
 public:
 
   /**
    * Gets the value for the index specified.  Takes index = 0,1,2
    * used for const
    */
-  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const { return _vals[i][j][k][l]; }
 
   /// Zeros out the tensor.
   void zero();
@@ -147,6 +147,8 @@ public:
   /**
    * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm)
    * This routine assumes that C_ijkl = C_jikl = C_ijlk
+   * The 6x6 Voigt matrix is inverted in place without LAPACK; tensors that do not couple
+   * normal and shear components take a closed-form path.
    */
   RankFourTensor invSymm() const;
 
@@ -197,17 +199,15 @@ protected:
   /// Dimensionality of rank-four tensor
   static const unsigned int N = LIBMESH_DIM;
 
+  /// Number of entries of a rank-two tensor, ie the size of the tensor viewed as a square matrix
+  static const unsigned int N2 = N * N;
+
+  /// Number of entries of the rank-four tensor
+  static const unsigned int N4 = N2 * N2;
+
   /// The values of the rank-four tensor
   Real _vals[N][N][N][N];
 
-  /**
-   * Inverts the dense matrix A using LAPACK routines
-   * @param A upon input this is a row vector representing an n-by-n matrix.  Upon output it is the inverse (as a row-vector)
-   * @param n size of A
-   * @return if zero then inversion was successful.  Otherwise A contained illegal entries or was singular
-   */
-  int matrixInversion(std::vector<PetscScalar> & A, int n) const;
-
   /**
   * fillSymmetricFromInputVector takes either 21 (all=true) or 9 (all=false) inputs to fill in
   * the Rank-4 tensor with the appropriate crystal symmetries maintained. I.e., C_ijkl = C_klij,
@@ -76,10 +76,10 @@ public:
   static RankTwoTensor Identity() { return RankTwoTensor(initIdentity); }
 
   /// Gets the value for the index specified.  Takes index = 0,1,2
-  Real & operator()(unsigned int i, unsigned int j);
+  Real & operator()(unsigned int i, unsigned int j) { return _vals[i][j]; }
 
   /// Gets the value for the index specified.  Takes index = 0,1,2, used for const
-  Real operator()(unsigned int i, unsigned int j) const;
+  Real operator()(unsigned int i, unsigned int j) const { return _vals[i][j]; }
 
   /// zeroes all _vals components
   void zero();
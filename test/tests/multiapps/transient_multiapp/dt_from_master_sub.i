@@ -36,6 +36,14 @@
   [../]
 []
 
+[Postprocessors]
+  # The same fixed cost for every App, used to re-balance the Apps reproducibly
+  [./cost]
+    type = NumElems
+    outputs = none
+  [../]
+[]
+
 [Executioner]
   type = Transient
   num_steps = 10
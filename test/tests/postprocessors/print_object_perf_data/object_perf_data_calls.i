@@ -0,0 +1,85 @@
+# The aux kernel runs once per node, on initial only, so its number of calls
+# does not depend on the solve or on the number of threads and processors
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Functions]
+  [./x_func]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./v_aux]
+    type = FunctionAux
+    variable = v
+    function = x_func
+    execute_on = initial
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./v_aux_calls]
+    type = ObjectPerformanceData
+    object = v_aux
+    category = aux_kernel
+    column = n_calls
+  [../]
+  [./v_aux_all_calls]
+    type = ObjectPerformanceData
+    object = v_aux
+    column = n_calls
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  output_on = timestep_end
+[]
@@ -0,0 +1,105 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Functions]
+  [./x_func]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./v_aux]
+    type = FunctionAux
+    variable = v
+    function = x_func
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./diff_calls]
+    type = ObjectPerformanceData
+    object = diff
+    column = n_calls
+  [../]
+  [./diff_residual_time]
+    type = ObjectPerformanceData
+    object = diff
+    category = residual
+    column = total_time
+  [../]
+  [./diff_jacobian_average_time]
+    type = ObjectPerformanceData
+    object = diff
+    category = jacobian
+    column = average_time
+  [../]
+  [./right_max_processor_time]
+    type = ObjectPerformanceData
+    object = right
+    column = max_processor_time
+  [../]
+  [./v_aux_calls]
+    type = ObjectPerformanceData
+    object = v_aux
+    category = aux_kernel
+    column = n_calls
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+  output_on = 'initial timestep_end'
+  [./console]
+    type = Console
+    object_perf_log = true
+    output_on = 'timestep_end failed nonlinear linear'
+  [../]
+[]
@@ -0,0 +1,103 @@
+# Residual assembly scaling benchmark
+#
+# Run with an increasing number of threads and compare the "ComputeResidualThread"
+# entry of the performance log, with and without per-thread residual buffers:
+#
+#   moose_test-opt -i thread_local_residual.i --n-threads=1
+#   moose_test-opt -i thread_local_residual.i --n-threads=N
+#   moose_test-opt -i thread_local_residual.i --n-threads=N Problem/thread_local_residual=false
+#
+# The DG kernel makes every internal face contribute to the neighbor residual,
+# which is the path that previously locked for every face.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 40
+  elem_type = HEX8
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./forcing_fn]
+    type = ParsedFunction
+    value = 2*pow(e,-x-(y*y))*(1-2*y*y)
+  [../]
+
+  [./exact_fn]
+    type = ParsedGradFunction
+    value = pow(e,-x-(y*y))
+    grad_x = -pow(e,-x-(y*y))
+    grad_y = -2*y*pow(e,-x-(y*y))
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./abs]
+    type = Reaction
+    variable = u
+  [../]
+
+  [./forcing]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+  [../]
+[]
+
+[DGKernels]
+  [./dg_diff]
+    type = DGDiffusion
+    variable = u
+    epsilon = -1
+    sigma = 6
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DGFunctionDiffusionDirichletBC
+    variable = u
+    boundary = '0 1 2 3 4 5'
+    function = exact_fn
+    epsilon = -1
+    sigma = 6
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  thread_local_residual = true
+[]
+
+[Executioner]
+  type = Steady
+
+  # JFNK so the run is dominated by residual evaluations
+  solve_type = 'JFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'none'
+  l_max_its = 50
+  nl_max_its = 2
+[]
+
+[Outputs]
+  output_on = 'timestep_end'
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ANISOTROPICTENSORFIXTURE_H
+#define ANISOTROPICTENSORFIXTURE_H
+
+// Moose includes
+#include "RankFourTensor.h"
+
+#include <vector>
+
+/**
+ * A fully anisotropic (symmetric21) elasticity tensor that couples normal and shear
+ * components.  The diagonal is made dominant so that the tensor is invertible.
+ */
+inline RankFourTensor
+anisotropicTensorFixture()
+{
+  std::vector<Real> input(21);
+  for (unsigned int i = 0; i < 21; ++i)
+    input[i] = 0.1 * (i + 1);
+
+  // C1111 C2222 C3333 C2323 C1313 C1212
+  input[0] += 10;
+  input[6] += 10;
+  input[11] += 10;
+  input[15] += 10;
+  input[18] += 10;
+  input[20] += 10;
+
+  RankFourTensor tensor;
+  tensor.fillFromInputVector(input, RankFourTensor::symmetric21);
+  return tensor;
+}
+
+#endif /* ANISOTROPICTENSORFIXTURE_H */
@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANKFOURTENSORBENCHMARK_H
+#define RANKFOURTENSORBENCHMARK_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "RankFourTensor.h"
+#include "RankTwoTensor.h"
+
+#include <ctime>
+#include <string>
+
+/**
+ * Measures the throughput of the RankFourTensor operations used per quadrature point by the
+ * finite strain materials.  These are not part of the regular unit tests; run them with
+ * "run_tests --benchmark".
+ */
+class RankFourTensorBenchmark : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( RankFourTensorBenchmark );
+
+  CPPUNIT_TEST( rankTwoProduct );
+  CPPUNIT_TEST( rankFourProduct );
+  CPPUNIT_TEST( outerProduct );
+  CPPUNIT_TEST( invSymm );
+  CPPUNIT_TEST( rotate );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  RankFourTensorBenchmark();
+
+  void rankTwoProduct();
+  void rankFourProduct();
+  void outerProduct();
+  void invSymm();
+  void rotate();
+
+private:
+  /// Prints the operations per second for n_ops operations that started at clock start
+  void report(const std::string & name, unsigned int n_ops, std::clock_t start, Real checksum) const;
+
+  /// Number of times every operation is repeated
+  const unsigned int _n_ops;
+
+  RankFourTensor _a;
+  RankFourTensor _b;
+  RankTwoTensor _s;
+};
+
+#endif  // RANKFOURTENSORBENCHMARK_H
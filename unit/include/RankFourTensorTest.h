@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANKFOURTENSORTEST_H
+#define RANKFOURTENSORTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "RankFourTensor.h"
+
+class RankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( RankFourTensorTest );
+
+  CPPUNIT_TEST( rankTwoProductTest );
+  CPPUNIT_TEST( rankFourProductTest );
+  CPPUNIT_TEST( invSymmIsotropicTest );
+  CPPUNIT_TEST( invSymmAnisotropicTest );
+  CPPUNIT_TEST( rotateTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  RankFourTensorTest();
+  ~RankFourTensorTest();
+
+  void rankTwoProductTest();
+  void rankFourProductTest();
+  void invSymmIsotropicTest();
+  void invSymmAnisotropicTest();
+  void rotateTest();
+
+ private:
+  RankFourTensor _iso;
+  RankFourTensor _aniso;
+  RankFourTensor _general;
+  RankFourTensor _symmetric_identity;
+};
+
+#endif  // RANKFOURTENSORTEST_H